@@ -0,0 +1,24 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       BaseTypes.h
+\brief      Host build variant of the base types.
+***********************************************************************************/
+#ifndef BASETYPES_H
+#define BASETYPES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t     u8;
+typedef uint16_t    u16;
+typedef uint32_t    u32;
+typedef uint64_t    u64;
+typedef int8_t      s8;
+typedef int16_t     s16;
+typedef int32_t     s32;
+typedef int64_t     s64;
+
+#endif // BASETYPES_H
@@ -0,0 +1,16 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_MemoryInit.h
+\brief      Host build variant of the memory initialization HAL.
+***********************************************************************************/
+#ifndef HAL_MEMORYINIT_H
+#define HAL_MEMORYINIT_H
+
+#include "BaseTypes.h"
+
+void HAL_MemoryInit_Init(void);
+
+#endif // HAL_MEMORYINIT_H
@@ -0,0 +1,33 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_CPU.h
+\brief      Host build variant of the CPU, memory and peripheral test HAL.
+            On target the March and CRC routines are part of the assembler files.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_CPU_H
+#define HAL_SELFTEST_CPU_H
+
+#include "BaseTypes.h"
+
+u8 HAL_SelfTest_CPU_Reg(void);
+u8 HAL_SelfTest_CPU_PC(void);
+u8 HAL_SelfTest_RAM(void);
+u8 HAL_SelfTest_Flash(void);
+u8 HAL_SelfTest_ADC(void);
+
+u8 SelfTest_March_Buffer(u32 ulStartAdr, u32 ulSize);
+u8 SelfTest_March_SRAM(u32 ulStartAdr, u32 ulSize, u32 ulEndAdr);
+u32 SelfTest_FlashCRCRead(u32 ulSegmentIdx);
+u8 eSelfTest_C_IO(u32 ulPort);
+u8 HAL_SelfTest_IO_CheckPorts(u32 ulFirstPort, u32 ulPorts, const u32* pulTestMask, u32* pulFailMask);
+u8 eSelfTest_S_ADC(void);
+
+// Resumable variants, see SELFTEST_MICRO_STEPS. Return PASS_STILL_TESTING_STATUS,
+// PASS_COMPLETE_STATUS after the last sub-step or ERROR_STATUS
+u8 HAL_SelfTest_CPU_RegStep(u32 ulGroup);
+u8 HAL_SelfTest_ADC_Step(u32 ulChannel);
+
+#endif // HAL_SELFTEST_CPU_H
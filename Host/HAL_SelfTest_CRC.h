@@ -0,0 +1,20 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_CRC.h
+\brief      Host build variant of the hardware CRC unit HAL.
+            Used with SELFTEST_CRC_ENGINE_HW. The background engine of
+            SELFTEST_CRC_ASYNC is emulated in HostSim_CRC.c.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_CRC_H
+#define HAL_SELFTEST_CRC_H
+
+#include "BaseTypes.h"
+
+u32 HAL_SelfTest_CRC_Calc(const u8* pucData, u32 ulLength, u32 ulCrc);
+u8 HAL_SelfTest_CRC_Start(const u8* pucData, u32 ulLength, u32 ulCrc);
+u8 HAL_SelfTest_CRC_Poll(u32* pulCrc);
+
+#endif // HAL_SELFTEST_CRC_H
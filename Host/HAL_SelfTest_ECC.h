@@ -0,0 +1,19 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_ECC.h
+\brief      Host build variant of the SRAM ECC HAL.
+            Used with SELFTEST_RAM_MODE_ECC_SCRUB. The ECC logic is emulated
+            in HostSim_ECC.c.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_ECC_H
+#define HAL_SELFTEST_ECC_H
+
+#include "BaseTypes.h"
+#include "OS_SelfTest_ECC.h"
+
+void HAL_SelfTest_ECC_GetCounters(tsSelfTest_EccCounters* psCounters);
+
+#endif // HAL_SELFTEST_ECC_H
@@ -0,0 +1,17 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_Reset.h
+\brief      Host build variant of the reset cause HAL.
+            Returns the cause of the last reset as SELFTEST_RESET_xxx bits.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_RESET_H
+#define HAL_SELFTEST_RESET_H
+
+#include "BaseTypes.h"
+
+u32 HAL_SelfTest_GetResetReason(void);
+
+#endif // HAL_SELFTEST_RESET_H
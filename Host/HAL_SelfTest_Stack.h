@@ -0,0 +1,21 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_Stack.h
+\brief      Host build variant of the stack test HAL.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_STACK_H
+#define HAL_SELFTEST_STACK_H
+
+#include "BaseTypes.h"
+
+void HAL_SelfTest_Stack_Init(void);
+u8 HAL_SelfTest_Stack_Check(void);
+u8 SelfTest_StackOverflow(void);
+
+// Resumable variant, see SELFTEST_MICRO_STEPS
+u8 HAL_SelfTest_Stack_CheckStep(u32 ulSegment);
+
+#endif // HAL_SELFTEST_STACK_H
@@ -0,0 +1,19 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_TimeBase.h
+\brief      Host build variant of the time base test HAL.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_TIMEBASE_H
+#define HAL_SELFTEST_TIMEBASE_H
+
+#include "BaseTypes.h"
+
+u8 HAL_SelfTest_TimeBase(void);
+u8 HAL_SelfTest_TimeBase_StartUp(void);
+u8 HAL_SelfTest_TimeBase_CyclicInit(void);
+u8 HAL_SelfTest_TimeBase_CyclicTest(void);
+
+#endif // HAL_SELFTEST_TIMEBASE_H
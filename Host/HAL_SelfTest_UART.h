@@ -0,0 +1,25 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_SelfTest_UART.h
+\brief      Host build variant of the UART test HAL.
+***********************************************************************************/
+#ifndef HAL_SELFTEST_UART_H
+#define HAL_SELFTEST_UART_H
+
+#include "BaseTypes.h"
+#include "OS_SelfTest_UART.h"
+
+void HAL_SelfTest_UART_Init(void);
+u8 HAL_SelfTest_UART_Check(void);
+
+// Resumable variant, see SELFTEST_MICRO_STEPS
+u8 HAL_SelfTest_UART_CheckStep(u32 ulPhase);
+
+// Driver state for the passive test, see SELFTEST_UART_MODE_PASSIVE
+void HAL_SelfTest_UART_GetCounters(tsSelfTest_UartCounters* psCounters);
+bool HAL_SelfTest_UART_IsQuiet(void);
+
+#endif // HAL_SELFTEST_UART_H
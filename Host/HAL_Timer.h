@@ -0,0 +1,16 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HAL_Timer.h
+\brief      Host build variant of the timer HAL.
+***********************************************************************************/
+#ifndef HAL_TIMER_H
+#define HAL_TIMER_H
+
+#include "BaseTypes.h"
+
+bool HAL_Timer_GetTimerStatus(void);
+
+#endif // HAL_TIMER_H
@@ -0,0 +1,1062 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HostSim
+\details    Linux host simulation of the self-test HAL. See HostSim.h
+*/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "HostSim.h"
+#include "OS_SelfTest.h"
+#include "OS_SelfTest_ADC.h"
+#include "OS_SelfTest_CRC.h"
+#include "OS_SelfTest_Flash.h"
+#include "SelfTest_Config.h"
+
+#include "HAL_MemoryInit.h"
+#include "HAL_SelfTest_CPU.h"
+#include "HAL_SelfTest_CRC.h"
+#include "HAL_SelfTest_Reset.h"
+#include "HAL_SelfTest_Stack.h"
+#include "HAL_SelfTest_TimeBase.h"
+#include "HAL_SelfTest_UART.h"
+#include "HAL_Timer.h"
+
+#include <string.h>
+#include <time.h>
+#if HOSTSIM_TIME_RDTSC == true
+    #include <x86intrin.h>
+#endif
+
+/****************************************** Defines ******************************************************/
+#define CALIBRATION_NS          (20000000u)     // 20ms to calibrate the time stamp counter
+#define STACK_CANARY            0xDEADBEEFu     // Fill pattern of the stack guard
+#define TIMEBASE_TEST_TICKS     (100u)          // Reference ticks of the cyclic time base test
+#define STACK_FAULT_BIT         0x00000100u     // Bit flipped by eHostSim_Fault_StackCanary
+
+#define FAULT_ACTIVE(eFault)    ((ulSimFaults & (1uL << (eFault))) != 0u)
+
+#define MARCH_PATTERN_0         0x00000000u
+#define MARCH_PATTERN_1         0xFFFFFFFFu
+
+
+/****************************************** Variables ****************************************************/
+// Simulated memories
+static u32 ulSimFlash[HOSTSIM_FLASH_MAX_SIZE / sizeof(u32)];
+static u32 ulSimSram[HOSTSIM_SRAM_MAX_SIZE / sizeof(u32)];
+static u32 ulSimStack[HOSTSIM_STACK_SIZE / sizeof(u32)];
+static u32 ulSimPortBank[HOSTSIM_IO_PORTS / HOSTSIM_IO_BANK_PORTS];   // Port n is byte n of the banks
+
+u32 HostSim_ulSramSize = 0u;
+u32 ulAppCodeStart = HOSTSIM_FLASH_BASE;
+u32 ulAppCodeLength = 0u;
+u32 HostSim_ulManifestAdr = 0u;
+
+static u32 ulFlashReferenceCrc = 0u;    // Post-link CRC of the image
+static u32 ulTimeBaseStart = 0u;        // Tick of the cyclic time base test init
+static u64 ullTimeBaseRef = 0u;         // Reference clock at the cyclic time base test init
+static u64 ullTimeStart = 0u;           // Start of the simulation in ns
+static u32 ulSimResetReason = SELFTEST_RESET_POWER_ON;  // Cause of the next simulated reset
+static u32 ulSimLoad = 0u;              // Part of each event period with a pending event in %
+static tsSelfTest_UartCounters sSimUart;    // Counters of the simulated UART driver
+
+// Injected faults
+static u32 ulSimFaults = 0u;                    // Bit n set: teHostSim_Fault n is active
+static volatile u8* pucSimStuckByte = NULL;     // SRAM byte with the stuck bit
+static u8 ucSimStuckMask = 0u;
+static u8 ucSimStuckValue = 0u;
+static u32 ulSimFlashFlip = 0u;                 // Flipped bit of the image
+static u32 ulSimStackFlip = 0u;                 // Guard word with the flipped bit
+static u32 ulSimStallTick = 0u;                 // System tick of the stalled time base
+static u32 ulSimIoStuckPin = 0u;                // Port * 8 + pin
+static u32 ulSimAdcOffset = 0u;                 // Added to the reference channel
+static u32 ulSimCpuRegGroup = 0u;               // Failing register group
+static u32 ulSimEccFlip = 0u;                   // First of the two flipped SRAM bits
+
+
+/****************************************** local functions *********************************************/
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Waits for a simulated peripheral. The thread sleeps, so the worker
+            of the emulated CRC engine gets the CPU like a DMA on target.
+\return     none
+\param      ulUs - Wait time in us
+**********************************************************************************/
+static void WaitPeripheral(u32 ulUs)
+{
+    struct timespec sWait;
+
+    sWait.tv_sec = ulUs / 1000000u;
+    sWait.tv_nsec = (long)(ulUs % 1000000u) * 1000L;
+    nanosleep(&sWait, NULL);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reference CRC-32 as calculated by the post-link step.
+            Independent of the engine selected for the self-test.
+\return     The CRC (inverted)
+\param      pucData - Start of the data
+\param      ulLength - Number of bytes
+**********************************************************************************/
+static u32 ReferenceCrc(const u8* pucData, u32 ulLength)
+{
+    u32 ulCrc = CRC_INIT_VALUE;
+
+    while(ulLength--)
+    {
+        u8 ucBit;
+        ulCrc ^= *pucData++;
+        for(ucBit = 0u; ucBit < 8u; ucBit++)
+        {
+            ulCrc = (ulCrc & 1u) ? ((ulCrc >> 1u) ^ 0xEDB88320u) : (ulCrc >> 1u);
+        }
+    }
+    return ~ulCrc;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reference CRC of a flash region as calculated by the post-link step,
+            bit by bit with the reflected polynomial of SELFTEST_CRC_POLY_xxx
+\return     The CRC (inverted)
+\param      ucPolynomial - SELFTEST_CRC_POLY_xxx
+\param      pucData - Start of the data
+\param      ulLength - Number of bytes
+**********************************************************************************/
+static u32 ReferenceCrcPoly(u8 ucPolynomial, const u8* pucData, u32 ulLength)
+{
+    u32 ulPoly = 0xEDB88320u;
+    u32 ulMask = SELFTEST_CRC_POLY_MASK(ucPolynomial);
+    u32 ulCrc = CRC_INIT_VALUE & ulMask;
+
+    if(ucPolynomial == SELFTEST_CRC_POLY_CRC32C)
+    {
+        ulPoly = 0x82F63B78u;
+    }
+    else if(ucPolynomial == SELFTEST_CRC_POLY_CRC16)
+    {
+        ulPoly = 0x8408u;
+    }
+
+    while(ulLength--)
+    {
+        u8 ucBit;
+        ulCrc ^= *pucData++;
+        for(ucBit = 0u; ucBit < 8u; ucBit++)
+        {
+            ulCrc = (ulCrc & 1u) ? ((ulCrc >> 1u) ^ ulPoly) : (ulCrc >> 1u);
+        }
+    }
+    return ~ulCrc & ulMask;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reads a cell of the March C- with the injected stuck bit
+\return     Content of the cell
+\param      pulCell - The cell
+**********************************************************************************/
+static u32 MarchCell(volatile u32* pulCell)
+{
+    return (u32)HostSim_FaultRead(pulCell, *pulCell, sizeof(u32));
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      March C- over a word area. Destroys the content.
+            {(w0); up(r0,w1); up(r1,w0); down(r0,w1); down(r1,w0); (r0)}
+\return     OK_STATUS or ERROR_STATUS
+\param      pulData - Start of the area
+\param      ulWords - Number of words
+**********************************************************************************/
+static u8 MarchC(volatile u32* pulData, u32 ulWords)
+{
+    u32 ulIdx;
+
+    for(ulIdx = 0u; ulIdx < ulWords; ulIdx++)
+    {
+        pulData[ulIdx] = MARCH_PATTERN_0;
+    }
+    for(ulIdx = 0u; ulIdx < ulWords; ulIdx++)
+    {
+        if(MarchCell(&pulData[ulIdx]) != MARCH_PATTERN_0) return ERROR_STATUS;
+        pulData[ulIdx] = MARCH_PATTERN_1;
+    }
+    for(ulIdx = 0u; ulIdx < ulWords; ulIdx++)
+    {
+        if(MarchCell(&pulData[ulIdx]) != MARCH_PATTERN_1) return ERROR_STATUS;
+        pulData[ulIdx] = MARCH_PATTERN_0;
+    }
+    for(ulIdx = ulWords; ulIdx-- > 0u; )
+    {
+        if(MarchCell(&pulData[ulIdx]) != MARCH_PATTERN_0) return ERROR_STATUS;
+        pulData[ulIdx] = MARCH_PATTERN_1;
+    }
+    for(ulIdx = ulWords; ulIdx-- > 0u; )
+    {
+        if(MarchCell(&pulData[ulIdx]) != MARCH_PATTERN_1) return ERROR_STATUS;
+        pulData[ulIdx] = MARCH_PATTERN_0;
+    }
+    for(ulIdx = 0u; ulIdx < ulWords; ulIdx++)
+    {
+        if(MarchCell(&pulData[ulIdx]) != MARCH_PATTERN_0) return ERROR_STATUS;
+    }
+    return OK_STATUS;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks the guard words at the limit of the simulated stack
+\return     OK_STATUS or ERROR_STATUS
+\param      none
+**********************************************************************************/
+static u8 CheckStackGuard(void)
+{
+    u32 ulIdx;
+
+    for(ulIdx = 0u; ulIdx < HOSTSIM_STACK_GUARD_WORDS; ulIdx++)
+    {
+        if(ulSimStack[ulIdx] != STACK_CANARY)
+        {
+            return ERROR_STATUS;
+        }
+    }
+    return OK_STATUS;
+}
+
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reads a register bank of the simulated ports with the injected
+            stuck pin
+\return     Content of the bank, port n in byte n
+\param      ulBank - Index of the bank
+**********************************************************************************/
+static u32 ReadPortBank(u32 ulBank)
+{
+    u32 ulValue = ((volatile u32*)ulSimPortBank)[ulBank];
+
+    if(FAULT_ACTIVE(eHostSim_Fault_IoStuckPin) && ((ulSimIoStuckPin / (HOSTSIM_IO_BANK_PORTS * 8u)) == ulBank))
+    {
+        ulValue &= ~(1uL << (ulSimIoStuckPin % (HOSTSIM_IO_BANK_PORTS * 8u)));
+    }
+    return ulValue;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Builds the flash manifest of the image like
+            Tools/SelfTest_FlashManifest.py, tiles of ST_FLASH_TILE_SIZE
+\return     none
+\param      ulManifestAdr - Simulated flash address of the manifest
+**********************************************************************************/
+static void BuildManifest(u32 ulManifestAdr)
+{
+    tsSelfTest_FlashManifest* psManifest = (tsSelfTest_FlashManifest*)&ulSimFlash[(ulManifestAdr - HOSTSIM_FLASH_BASE) / sizeof(u32)];
+    u32 ulTile;
+
+    psManifest->ulSignature = SELFTEST_MANIFEST_SIGNATURE;
+    psManifest->ulStartAdr = ulAppCodeStart;
+    psManifest->ulLength = ulAppCodeLength;
+    psManifest->ulTileSize = ST_FLASH_TILE_SIZE;
+    psManifest->ulTileCount = (ulAppCodeLength + ST_FLASH_TILE_SIZE - 1u) / ST_FLASH_TILE_SIZE;
+
+    for(ulTile = 0u; ulTile < psManifest->ulTileCount; ulTile++)
+    {
+        u32 ulOffset = ulTile * ST_FLASH_TILE_SIZE;
+        u32 ulSize = ((ulAppCodeLength - ulOffset) < ST_FLASH_TILE_SIZE) ? (ulAppCodeLength - ulOffset) : ST_FLASH_TILE_SIZE;
+
+        psManifest->aulTileCrc[ulTile] = ReferenceCrc(HostSim_FlashPtr(ulAppCodeStart + ulOffset), ulSize);
+    }
+    psManifest->aulTileCrc[ulTile] = ReferenceCrc((const u8*)psManifest, (5u + ulTile) * sizeof(u32));
+
+    HostSim_ulManifestAdr = ulManifestAdr;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Writes the reference CRCs of the flash regions of SELFTEST_FLASH_REGIONS
+            behind the constant tables like the post-link step
+\return     none
+\param      none
+**********************************************************************************/
+static void BuildRegionReferences(void)
+{
+    const u32 aulStart[HOSTSIM_REGIONS] = { HOSTSIM_BOOT_ADR, ulAppCodeStart, HOSTSIM_CALIB_ADR, HOSTSIM_CONST_ADR };
+    const u32 aulLength[HOSTSIM_REGIONS] = { HOSTSIM_BOOT_SIZE, ulAppCodeLength, HOSTSIM_CALIB_SIZE, HOSTSIM_CONST_SIZE };
+    const u8 aucPolynomial[HOSTSIM_REGIONS] = { SELFTEST_CRC_POLY_CRC32, SELFTEST_CRC_POLY_CRC32, SELFTEST_CRC_POLY_CRC16, SELFTEST_CRC_POLY_CRC32C };
+    u32 ulRegion;
+
+    for(ulRegion = 0u; ulRegion < HOSTSIM_REGIONS; ulRegion++)
+    {
+        ulSimFlash[(HOSTSIM_REGION_REF_ADR(ulRegion) - HOSTSIM_FLASH_BASE) / sizeof(u32)]
+            = ReferenceCrcPoly(aucPolynomial[ulRegion], HostSim_FlashPtr(aulStart[ulRegion]), aulLength[ulRegion]);
+    }
+}
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Initializes the simulated memories. The flash image is filled with
+            a pseudo random pattern, its reference CRC is calculated and the
+            tile manifest is placed behind the image like the post-link step does.
+            The references of the flash regions are placed at the end of the flash.
+\return     none
+\param      ulSramSize - Simulated SRAM size, limited to HOSTSIM_SRAM_MAX_SIZE
+\param      ulFlashSize - Application image size, limited to HOSTSIM_IMAGE_MAX_SIZE
+***********************************************************************************/
+void HostSim_Init(u32 ulSramSize, u32 ulFlashSize)
+{
+    u32 ulIdx;
+    u32 ulSeed = 0x12345678u;
+
+    if(ulSramSize > HOSTSIM_SRAM_MAX_SIZE) ulSramSize = HOSTSIM_SRAM_MAX_SIZE;
+    if(ulFlashSize > HOSTSIM_IMAGE_MAX_SIZE) ulFlashSize = HOSTSIM_IMAGE_MAX_SIZE;
+
+    HostSim_ulSramSize = ulSramSize & ~(sizeof(u64) - 1u);
+    ulAppCodeStart = HOSTSIM_FLASH_BASE;
+    ulAppCodeLength = ulFlashSize & ~(sizeof(u32) - 1u);
+
+    for(ulIdx = 0u; ulIdx < (HOSTSIM_FLASH_MAX_SIZE / sizeof(u32)); ulIdx++)
+    {
+        ulSeed = (ulSeed * 1664525u) + 1013904223u;
+        ulSimFlash[ulIdx] = ulSeed;
+    }
+    ulFlashReferenceCrc = ReferenceCrc((const u8*)ulSimFlash, ulAppCodeLength);
+    BuildManifest(ulAppCodeStart + ulAppCodeLength);
+    BuildRegionReferences();
+
+    memset(ulSimPortBank, 0, sizeof(ulSimPortBank));
+    ullTimeStart = HostSim_GetTimeNs();
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Maps a simulated SRAM address to the host memory
+\return     Pointer into the simulated SRAM
+\param      ulAdr - Simulated address
+***********************************************************************************/
+u8* HostSim_SramPtr(u32 ulAdr)
+{
+    return (u8*)ulSimSram + (ulAdr - HOSTSIM_SRAM_BASE);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Maps a simulated flash address to the host memory
+\return     Pointer into the simulated flash
+\param      ulAdr - Simulated address
+***********************************************************************************/
+const u8* HostSim_FlashPtr(u32 ulAdr)
+{
+    return (const u8*)ulSimFlash + (ulAdr - HOSTSIM_FLASH_BASE);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the CPU cycle counter, see HOSTSIM_TIME_RDTSC.
+            Nanoseconds of the monotonic clock without the time stamp counter.
+\return     Cycle count, lower 32 bit
+\param      none
+***********************************************************************************/
+u32 HostSim_GetCycles(void)
+{
+    #if HOSTSIM_TIME_RDTSC == true
+        return (u32)__rdtsc();
+    #else
+        return (u32)HostSim_GetTimeNs();
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Frequency of HostSim_GetCycles(). The time stamp counter is
+            measured against the monotonic clock on the first call.
+\return     Cycles per second
+\param      none
+***********************************************************************************/
+u64 HostSim_GetCyclesHz(void)
+{
+    #if HOSTSIM_TIME_RDTSC == true
+        static u64 ullCyclesHz = 0u;
+
+        if(ullCyclesHz == 0u)
+        {
+            u64 ullStart = HostSim_GetTimeNs();
+            u64 ullStartCycles = __rdtsc();
+            u64 ullElapsed;
+
+            do
+            {
+                ullElapsed = HostSim_GetTimeNs() - ullStart;
+            }while(ullElapsed < CALIBRATION_NS);
+
+            ullCyclesHz = ((__rdtsc() - ullStartCycles) * 1000000000u) / ullElapsed;
+        }
+        return ullCyclesHz;
+    #else
+        return 1000000000u;
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the monotonic host time
+\return     Time in ns
+\param      none
+***********************************************************************************/
+u64 HostSim_GetTimeNs(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return ((u64)sTime.tv_sec * 1000000000u) + (u64)sTime.tv_nsec;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Simulated system tick of the OS software timer
+\return     Ticks of HOSTSIM_TICK_US since HostSim_Init()
+\param      none
+***********************************************************************************/
+u32 OS_SW_Timer_GetSystemTickCount(void)
+{
+    if(FAULT_ACTIVE(eHostSim_Fault_TimeBaseStall))
+    {
+        return ulSimStallTick;
+    }
+    return (u32)((HostSim_GetTimeNs() - ullTimeStart) / (1000u * HOSTSIM_TICK_US));
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Sets the cause reported for the next simulated reset
+\return     none
+\param      ulReason - SELFTEST_RESET_xxx bits
+***********************************************************************************/
+void HostSim_SetResetReason(u32 ulReason)
+{
+    ulSimResetReason = ulReason;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Sets the simulated system load. An event is pending at the start
+            of each HOSTSIM_EVENT_PERIOD_US for the given part of the period.
+\return     none
+\param      ulPercent - Load in %, 0 = never busy
+***********************************************************************************/
+void HostSim_SetLoad(u32 ulPercent)
+{
+    ulSimLoad = (ulPercent > 100u) ? 100u : ulPercent;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Event query of the simulated OS
+\return     true while an event is pending
+\param      none
+***********************************************************************************/
+bool HostSim_IsEventPending(void)
+{
+    u64 ullPeriodNs = HOSTSIM_EVENT_PERIOD_US * 1000u;
+
+    return ((HostSim_GetTimeNs() - ullTimeStart) % ullPeriodNs) < ((ullPeriodNs * ulSimLoad) / 100u);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Start of the actual event period
+\return     Time in ns, see HostSim_GetTimeNs()
+\param      none
+***********************************************************************************/
+u64 HostSim_GetEventStartNs(void)
+{
+    u64 ullPeriodNs = HOSTSIM_EVENT_PERIOD_US * 1000u;
+    u64 ullNow = HostSim_GetTimeNs();
+
+    return ullNow - ((ullNow - ullTimeStart) % ullPeriodNs);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Conversion sequence of the simulated application. The sequence has
+            one free slot, which converts the channel requested by the ADC self
+            test. The result is delivered with the next sequence.
+            The simulated references have a noise of +-3 LSB.
+\return     none
+\param      none
+***********************************************************************************/
+void HostSim_AdcSequence(void)
+{
+    static u32 ulNoise = 0x1234u;
+    static bool bConverting = false;
+    static u8 ucChannel = 0u;
+
+    /* Result of the slot of the last sequence */
+    if(bConverting)
+    {
+        u16 usValue = 0u;
+
+        ulNoise = (ulNoise * 1103515245u) + 12345u;
+        switch(ucChannel)
+        {
+            case HOSTSIM_ADC_CH_VREF:   usValue = (u16)(1489u + ((ulNoise >> 16u) % 7u) - 3u + ulSimAdcOffset);  break;
+            case HOSTSIM_ADC_CH_VSS:    usValue = (u16)((ulNoise >> 16u) % 4u);                 break;
+            case HOSTSIM_ADC_CH_VDD:    usValue = (u16)(4095u - ((ulNoise >> 16u) % 4u));       break;
+            default:                                                                            break;
+        }
+        OS_SelfTest_ADC_SlotResult(ucChannel, usValue);
+    }
+    bConverting = OS_SelfTest_ADC_GetSlotRequest(&ucChannel);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Bus traffic of the simulated application. Receives one frame per
+            call, every HOSTSIM_UART_CRC_ERROR_RATE frame with a wrong CRC.
+            No traffic while the simulated system is busy.
+\return     none
+\param      none
+***********************************************************************************/
+void HostSim_UartTraffic(void)
+{
+    if(HostSim_IsEventPending() == false)
+    {
+        sSimUart.ulRxFrames++;
+        if(FAULT_ACTIVE(eHostSim_Fault_UartLineErrors))
+        {
+            sSimUart.ulFramingErrors++;
+        }
+        if((sSimUart.ulRxFrames % HOSTSIM_UART_CRC_ERROR_RATE) == 0u)
+        {
+            sSimUart.ulCrcErrors++;
+        }
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Injects a fault into the simulation. The fault stays until
+            HostSim_ClearFaults(), several faults can be active at once.
+\return     none
+\param      eFault - The fault
+\param      ulParam - Location of the fault, see teHostSim_Fault
+***********************************************************************************/
+void HostSim_InjectFault(teHostSim_Fault eFault, u32 ulParam)
+{
+    switch(eFault)
+    {
+        case eHostSim_Fault_RamStuckBit:
+        {
+            pucSimStuckByte = HostSim_SramPtr(HOSTSIM_SRAM_BASE + ((ulParam / 8u) % HostSim_ulSramSize));
+            ucSimStuckMask = (u8)(1u << (ulParam % 8u));
+            ucSimStuckValue = (u8)(~*pucSimStuckByte & ucSimStuckMask);
+            break;
+        }
+
+        case eHostSim_Fault_FlashBitFlip:
+        {
+            ulSimFlashFlip = ulParam % (ulAppCodeLength * 8u);
+            ((u8*)ulSimFlash)[ulSimFlashFlip / 8u] ^= (u8)(1u << (ulSimFlashFlip % 8u));
+            break;
+        }
+
+        case eHostSim_Fault_StackCanary:
+        {
+            ulSimStackFlip = ulParam % HOSTSIM_STACK_GUARD_WORDS;
+            ulSimStack[ulSimStackFlip] ^= STACK_FAULT_BIT;
+            break;
+        }
+
+        case eHostSim_Fault_TimeBaseStall:
+        {
+            ulSimStallTick = OS_SW_Timer_GetSystemTickCount();
+            break;
+        }
+
+        case eHostSim_Fault_IoStuckPin:
+        {
+            ulSimIoStuckPin = ulParam % (HOSTSIM_IO_PORTS * 8u);
+            break;
+        }
+
+        case eHostSim_Fault_AdcDrift:
+        {
+            ulSimAdcOffset = ulParam;
+            break;
+        }
+
+        case eHostSim_Fault_CpuReg:
+        {
+            ulSimCpuRegGroup = ulParam % HOSTSIM_CPUREG_GROUPS;
+            break;
+        }
+
+        case eHostSim_Fault_RamEccDouble:
+        {
+            ulSimEccFlip = (ulParam % (HostSim_ulSramSize * 8u)) & ~1u;
+            ((u8*)ulSimSram)[ulSimEccFlip / 8u] ^= (u8)(3u << (ulSimEccFlip % 8u));
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    if((u32)eFault < eHostSim_Fault_COUNT)
+    {
+        ulSimFaults |= (1uL << eFault);
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Removes all injected faults and repairs the simulated memories
+\return     none
+\param      none
+***********************************************************************************/
+void HostSim_ClearFaults(void)
+{
+    if(FAULT_ACTIVE(eHostSim_Fault_FlashBitFlip))
+    {
+        ((u8*)ulSimFlash)[ulSimFlashFlip / 8u] ^= (u8)(1u << (ulSimFlashFlip % 8u));
+    }
+    if(FAULT_ACTIVE(eHostSim_Fault_StackCanary))
+    {
+        ulSimStack[ulSimStackFlip] = STACK_CANARY;
+    }
+    if(FAULT_ACTIVE(eHostSim_Fault_RamEccDouble))
+    {
+        ((u8*)ulSimSram)[ulSimEccFlip / 8u] ^= (u8)(3u << (ulSimEccFlip % 8u));
+    }
+    pucSimStuckByte = NULL;
+    ulSimAdcOffset = 0u;
+    ulSimFaults = 0u;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Applies the stuck bit of eHostSim_Fault_RamStuckBit to a read.
+            Used by the March tests, see SELFTEST_MARCH_READ.
+\return     The read value with the stuck bit when it is in the cell
+\param      pvCell - The read cell
+\param      ullValue - Content of the cell
+\param      ulSize - Size of the cell in bytes, at most 8
+***********************************************************************************/
+u64 HostSim_FaultRead(const volatile void* pvCell, u64 ullValue, u32 ulSize)
+{
+    const volatile u8* pucCell = (const volatile u8*)pvCell;
+
+    if(pucSimStuckByte && (pucSimStuckByte >= pucCell) && (pucSimStuckByte < (pucCell + ulSize)))
+    {
+        u32 ulShift = (u32)(pucSimStuckByte - pucCell) * 8u;     // Little endian host
+
+        ullValue = (ullValue & ~((u64)ucSimStuckMask << ulShift)) | ((u64)ucSimStuckValue << ulShift);
+    }
+    return ullValue;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Maps a simulated stack address to the host memory
+\return     Pointer to the word
+\param      ulAdr - Address from HOSTSIM_STACK_BASE
+***********************************************************************************/
+volatile u32* HostSim_StackPtr(u32 ulAdr)
+{
+    return &ulSimStack[(ulAdr - HOSTSIM_STACK_BASE) / sizeof(u32)];
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Stack pointer of the simulated startup, some frames below the top
+\return     Simulated stack address
+\param      none
+***********************************************************************************/
+u32 HostSim_GetStackPointer(void)
+{
+    return HOSTSIM_STACK_BASE + HOSTSIM_STACK_SIZE - 128u;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Stack use of the simulated application. Each call uses the stack
+            down to a random depth, rarely deeper than half of
+            HOSTSIM_STACK_DEPTH. Not every word of a frame is written.
+\return     none
+\param      none
+***********************************************************************************/
+void HostSim_StackLoad(void)
+{
+    static u32 ulSeed = 0x9E3779B9u;
+    u32 ulDepth;
+    u32 ulIdx;
+
+    ulSeed = (ulSeed * 1664525u) + 1013904223u;
+    ulDepth = ((ulSeed >> 8u) % 64u) ? ((ulSeed >> 16u) % (HOSTSIM_STACK_DEPTH / 2u)) : ((ulSeed >> 16u) % HOSTSIM_STACK_DEPTH);
+
+    for(ulIdx = 0u; ulIdx < ulDepth; ulIdx += 2u * sizeof(u32))
+    {
+        ulSimStack[((HOSTSIM_STACK_SIZE - ulIdx) / sizeof(u32)) - 1u] = ulIdx;
+    }
+}
+
+
+/****************************************** Simulated HAL ***********************************************/
+void HAL_MemoryInit_Init(void)
+{
+    /* Static memory of the host process is already initialized, only the ECC check bits are written */
+    HostSim_EccInit();
+}
+
+u32 HAL_SelfTest_GetResetReason(void)
+{
+    return ulSimResetReason;
+}
+
+u8 HAL_SelfTest_CPU_Reg(void)
+{
+    return FAULT_ACTIVE(eHostSim_Fault_CpuReg) ? eSelfTest_ERROR : eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_CPU_RegStep(u32 ulGroup)
+{
+    if(FAULT_ACTIVE(eHostSim_Fault_CpuReg) && (ulGroup == ulSimCpuRegGroup))
+    {
+        return ERROR_STATUS;
+    }
+    return ((ulGroup + 1u) < HOSTSIM_CPUREG_GROUPS) ? PASS_STILL_TESTING_STATUS : PASS_COMPLETE_STATUS;
+}
+
+u8 HAL_SelfTest_CPU_PC(void)
+{
+    return eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_RAM(void)
+{
+    /* Startup test runs before memory initialization and may destroy the content */
+    return MarchC((volatile u32*)ulSimSram, HostSim_ulSramSize / sizeof(u32));
+}
+
+u8 HAL_SelfTest_Flash(void)
+{
+    u32 ulCrc = OS_SelfTest_CRC_Calc(HostSim_FlashPtr(ulAppCodeStart), ulAppCodeLength, CRC_INIT_VALUE);
+
+    return (~ulCrc == ulFlashReferenceCrc) ? eSelfTest_OK : eSelfTest_ERROR;
+}
+
+u8 HAL_SelfTest_ADC(void)
+{
+    WaitPeripheral(HOSTSIM_WAIT_ADC_US);
+    return eSelfTest_OK;
+}
+
+u8 SelfTest_March_Buffer(u32 ulStartAdr, u32 ulSize)
+{
+    return MarchC((volatile u32*)HostSim_SramPtr(ulStartAdr), ulSize / sizeof(u32));
+}
+
+u8 SelfTest_March_SRAM(u32 ulStartAdr, u32 ulSize, u32 ulEndAdr)
+{
+    u8 ucResult = PASS_STILL_TESTING_STATUS;
+    u8* pucTile = HostSim_SramPtr(ulStartAdr);
+    u8* pucBuffer = HostSim_SramPtr(TEST_BUFFER_STARTADR);
+
+    /* Last tile ends at the end address */
+    if((ulStartAdr + ulSize) > ulEndAdr)
+    {
+        ulSize = (ulEndAdr + 1u) - ulStartAdr;
+        ucResult = PASS_COMPLETE_STATUS;
+    }
+
+    /* Save the content, test the tile and restore the content */
+    memcpy(pucBuffer, pucTile, ulSize);
+    if(MarchC((volatile u32*)pucTile, ulSize / sizeof(u32)) != OK_STATUS)
+    {
+        ucResult = ERROR_STATUS;
+    }
+    memcpy(pucTile, pucBuffer, ulSize);
+
+    return ucResult;
+}
+
+u32 SelfTest_FlashCRCRead(u32 ulSegmentIdx)
+{
+    (void)ulSegmentIdx;
+    return ulFlashReferenceCrc;
+}
+
+u8 eSelfTest_C_IO(u32 ulPort)
+{
+    volatile u8* ucSimPort = (volatile u8*)ulSimPortBank;
+    u32 ulShift = (ulPort % HOSTSIM_IO_BANK_PORTS) * 8u;
+    u8 ucResult = eSelfTest_OK;
+
+    /* Write and read back both patterns on the stub port */
+    ucSimPort[ulPort] = 0x55u;
+    if(((ReadPortBank(ulPort / HOSTSIM_IO_BANK_PORTS) >> ulShift) & 0xFFu) != 0x55u) ucResult = eSelfTest_ERROR;
+    ucSimPort[ulPort] = 0xAAu;
+    if(((ReadPortBank(ulPort / HOSTSIM_IO_BANK_PORTS) >> ulShift) & 0xFFu) != 0xAAu) ucResult = eSelfTest_ERROR;
+
+    return ucResult;
+}
+
+u8 HAL_SelfTest_IO_CheckPorts(u32 ulFirstPort, u32 ulPorts, const u32* pulTestMask, u32* pulFailMask)
+{
+    u8 ucResult = eSelfTest_OK;
+    u32 ulEnd = ulFirstPort + ulPorts;
+    u32 ulPort = ulFirstPort;
+
+    /* One read-modify-write per bank and pattern for all ports of the bank */
+    while(ulPort < ulEnd)
+    {
+        u32 ulBank = ulPort / HOSTSIM_IO_BANK_PORTS;
+        volatile u32* pulBank = &ulSimPortBank[ulBank];
+        u32 ulBankEnd = ((ulPort / HOSTSIM_IO_BANK_PORTS) + 1u) * HOSTSIM_IO_BANK_PORTS;
+        u32 ulBankMask = 0u;
+        u32 ulFail;
+        u32 ulIdx;
+
+        if(ulBankEnd > ulEnd) ulBankEnd = ulEnd;
+        for(ulIdx = ulPort; ulIdx < ulBankEnd; ulIdx++)
+        {
+            ulBankMask |= (pulTestMask[ulIdx - ulFirstPort] & 0xFFu) << ((ulIdx % HOSTSIM_IO_BANK_PORTS) * 8u);
+        }
+
+        *pulBank = (*pulBank & ~ulBankMask) | (0x55555555u & ulBankMask);
+        ulFail = (ReadPortBank(ulBank) ^ 0x55555555u) & ulBankMask;
+        *pulBank = (*pulBank & ~ulBankMask) | (0xAAAAAAAAu & ulBankMask);
+        ulFail |= (ReadPortBank(ulBank) ^ 0xAAAAAAAAu) & ulBankMask;
+
+        for(ulIdx = ulPort; ulIdx < ulBankEnd; ulIdx++)
+        {
+            pulFailMask[ulIdx - ulFirstPort] = (ulFail >> ((ulIdx % HOSTSIM_IO_BANK_PORTS) * 8u)) & 0xFFu;
+        }
+        if(ulFail)
+        {
+            ucResult = eSelfTest_ERROR;
+        }
+        ulPort = ulBankEnd;
+    }
+    return ucResult;
+}
+
+u8 eSelfTest_S_ADC(void)
+{
+    return eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_ADC_Step(u32 ulChannel)
+{
+    return ((ulChannel + 1u) < HOSTSIM_ADC_CHANNELS) ? PASS_STILL_TESTING_STATUS : PASS_COMPLETE_STATUS;
+}
+
+u32 HAL_SelfTest_CRC_Calc(const u8* pucData, u32 ulLength, u32 ulCrc)
+{
+    /* The simulated CRC unit uses the bitwise reference */
+    while(ulLength--)
+    {
+        u8 ucBit;
+        ulCrc ^= *pucData++;
+        for(ucBit = 0u; ucBit < 8u; ucBit++)
+        {
+            ulCrc = (ulCrc & 1u) ? ((ulCrc >> 1u) ^ 0xEDB88320u) : (ulCrc >> 1u);
+        }
+    }
+    return ulCrc;
+}
+
+void HAL_SelfTest_Stack_Init(void)
+{
+    u32 ulIdx;
+
+    for(ulIdx = 0u; ulIdx < HOSTSIM_STACK_GUARD_WORDS; ulIdx++)
+    {
+        ulSimStack[ulIdx] = STACK_CANARY;
+    }
+}
+
+u8 HAL_SelfTest_Stack_Check(void)
+{
+    return CheckStackGuard();
+}
+
+u8 HAL_SelfTest_Stack_CheckStep(u32 ulSegment)
+{
+    const u32 ulSegmentWords = HOSTSIM_STACK_GUARD_WORDS / HOSTSIM_STACK_SEGMENTS;
+    u32 ulIdx;
+
+    for(ulIdx = ulSegment * ulSegmentWords; ulIdx < ((ulSegment + 1u) * ulSegmentWords); ulIdx++)
+    {
+        if(ulSimStack[ulIdx] != STACK_CANARY)
+        {
+            return ERROR_STATUS;
+        }
+    }
+    return ((ulSegment + 1u) < HOSTSIM_STACK_SEGMENTS) ? PASS_STILL_TESTING_STATUS : PASS_COMPLETE_STATUS;
+}
+
+u8 SelfTest_StackOverflow(void)
+{
+    return CheckStackGuard();
+}
+
+u8 HAL_SelfTest_TimeBase(void)
+{
+    WaitPeripheral(HOSTSIM_WAIT_TIMEBASE_US);
+    return eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_TimeBase_StartUp(void)
+{
+    WaitPeripheral(HOSTSIM_WAIT_STARTUP_US);
+    return eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_TimeBase_CyclicInit(void)
+{
+    ulTimeBaseStart = OS_SW_Timer_GetSystemTickCount();
+    ullTimeBaseRef = HostSim_GetTimeNs();
+    return eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_TimeBase_CyclicTest(void)
+{
+    /* Pending until the reference time has elapsed, then the system ticks
+       have to match the reference clock (monotonic host clock) by +-25% */
+    u8 ucResult = eSelfTest_NotExecuted;
+    u32 ulRefTicks = (u32)((HostSim_GetTimeNs() - ullTimeBaseRef) / (1000u * HOSTSIM_TICK_US));
+
+    if(ulRefTicks >= TIMEBASE_TEST_TICKS)
+    {
+        u32 ulTicks = OS_SW_Timer_GetSystemTickCount() - ulTimeBaseStart;
+
+        ucResult = eSelfTest_OK;
+        if((ulTicks < ((ulRefTicks * 3u) / 4u)) || (ulTicks > ((ulRefTicks * 5u) / 4u)))
+        {
+            ucResult = eSelfTest_ERROR;
+        }
+    }
+    return ucResult;
+}
+
+void HAL_SelfTest_UART_Init(void)
+{
+}
+
+u8 HAL_SelfTest_UART_Check(void)
+{
+    WaitPeripheral(HOSTSIM_WAIT_UART_US);
+    return eSelfTest_OK;
+}
+
+u8 HAL_SelfTest_UART_CheckStep(u32 ulPhase)
+{
+    return ((ulPhase + 1u) < HOSTSIM_UART_PHASES) ? PASS_STILL_TESTING_STATUS : PASS_COMPLETE_STATUS;
+}
+
+void HAL_SelfTest_UART_GetCounters(tsSelfTest_UartCounters* psCounters)
+{
+    *psCounters = sSimUart;
+}
+
+bool HAL_SelfTest_UART_IsQuiet(void)
+{
+    return true;
+}
+
+bool HAL_Timer_GetTimerStatus(void)
+{
+    return true;
+}
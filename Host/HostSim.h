@@ -0,0 +1,159 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HostSim.h
+\brief      Linux host simulation of the self-test HAL.
+            Simulated SRAM and flash arrays, a tick source based on the monotonic
+*           clock, stub ports and C versions of the assembler March routines.
+*           Addresses used by the self-test module are mapped into the arrays:
+*           flash starts at HOSTSIM_FLASH_BASE, SRAM at HOSTSIM_SRAM_BASE.
+*
+*           Build of the benchmark from the repository root:
+*           gcc -O2 -IHost -I. OS_SelfTest.c OS_SelfTest_ADC.c OS_SelfTest_CRC.c OS_SelfTest_ECC.c
+*               OS_SelfTest_Flash.c OS_SelfTest_History.c OS_SelfTest_March.c OS_SelfTest_Stack.c
+*               OS_SelfTest_Time.c OS_SelfTest_UART.c
+*               Host/HostSim.c Host/HostSim_CRC.c Host/HostSim_ECC.c Host/SelfTest_Benchmark.c
+*               -o SelfTest_Benchmark -lpthread
+*
+*           Faults are injected at runtime with HostSim_InjectFault(). The harness
+*           Host/SelfTest_FaultInjection.c replaces Host/SelfTest_Benchmark.c and is
+*           built with -DHOSTSIM_FAULT_INJECTION=true, which routes the reads of the
+*           March tests through the stuck bit model and returns from a failed test
+*           into the harness instead of stopping.
+*
+*           -DHOSTSIM_OVERLOAD=true builds the benchmark with a CPU register test
+*           period shorter than its own cost, the pass has no bound and the
+*           fault reaction time is reported as exceeded.
+***********************************************************************************/
+#ifndef HOSTSIM_H
+#define HOSTSIM_H
+
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+/***************************** defines / macros ******************************/
+#define HOSTSIM_FLASH_BASE          (0x00000000u)
+#define HOSTSIM_SRAM_BASE           (0x20000000u)
+#define HOSTSIM_STACK_BASE          (0x2FFF0000u)   // Outside of the simulated SRAM
+
+// Biggest simulated memories. The used size is set with HostSim_Init()
+#ifndef HOSTSIM_FLASH_MAX_SIZE
+    #define HOSTSIM_FLASH_MAX_SIZE  (8u * 1024u * 1024u)
+#endif
+#ifndef HOSTSIM_SRAM_MAX_SIZE
+    #define HOSTSIM_SRAM_MAX_SIZE   (1024u * 1024u)
+#endif
+
+// Biggest image, the rest of the flash holds the tile manifest and the flash regions
+#define HOSTSIM_IMAGE_MAX_SIZE      (HOSTSIM_FLASH_MAX_SIZE - (HOSTSIM_FLASH_MAX_SIZE / 64u))
+
+// Flash regions besides the image at the end of the flash: bootloader, calibration
+// data and constant tables, followed by the reference CRCs of SELFTEST_FLASH_REGIONS
+#define HOSTSIM_BOOT_SIZE           (8u * 1024u)
+#define HOSTSIM_CALIB_SIZE          (1024u)
+#define HOSTSIM_CONST_SIZE          (16u * 1024u)
+#define HOSTSIM_REGIONS             (4u)            // Including the image
+#define HOSTSIM_BOOT_ADR            (HOSTSIM_FLASH_BASE + HOSTSIM_FLASH_MAX_SIZE - (HOSTSIM_REGIONS * sizeof(u32)) \
+                                     - HOSTSIM_CONST_SIZE - HOSTSIM_CALIB_SIZE - HOSTSIM_BOOT_SIZE)
+#define HOSTSIM_CALIB_ADR           (HOSTSIM_BOOT_ADR + HOSTSIM_BOOT_SIZE)
+#define HOSTSIM_CONST_ADR           (HOSTSIM_CALIB_ADR + HOSTSIM_CALIB_SIZE)
+#define HOSTSIM_REGION_REF_ADR(ulRegion)    (HOSTSIM_CONST_ADR + HOSTSIM_CONST_SIZE + ((ulRegion) * sizeof(u32)))
+
+#define HOSTSIM_STACK_SIZE          (2048u)         // Simulated stack area
+#define HOSTSIM_STACK_GUARD_WORDS   (8u)            // Guard words at the stack limit
+#define HOSTSIM_STACK_DEPTH         (1024u)         // Deepest stack use of the simulated application
+#define HOSTSIM_IO_PORTS            (8u)            // Simulated IO ports
+#define HOSTSIM_IO_BANK_PORTS       (4u)            // 8bit ports in one 32bit register bank
+#define HOSTSIM_TICK_US             (1u)            // Length of one system tick in us
+#define HOSTSIM_EVENT_PERIOD_US     (1000u)         // Period of the simulated load
+#define HOSTSIM_CPUREG_GROUPS       (4u)            // Register groups of the CPU register test
+#define HOSTSIM_STACK_SEGMENTS      (4u)            // Segments of the stack guard
+#define HOSTSIM_ADC_CHANNELS        (4u)            // Tested ADC channels
+#define HOSTSIM_ADC_CH_VREF         (16u)           // Internal reference, 1.2V of 3.3V
+#define HOSTSIM_ADC_CH_VSS          (17u)           // Ground
+#define HOSTSIM_ADC_CH_VDD          (18u)           // Supply
+#define HOSTSIM_UART_PHASES         (3u)            // UART test: send, wait, compare
+#define HOSTSIM_UART_CRC_ERROR_RATE (500u)          // One frame with wrong CRC every n frames
+
+// Peripheral waits of the startup tests in us, the CPU sleeps like on a conversion or frame
+#define HOSTSIM_WAIT_TIMEBASE_US    (100u)          // Interrupt test
+#define HOSTSIM_WAIT_ADC_US         (200u)          // Conversions of the reference channels
+#define HOSTSIM_WAIT_UART_US        (300u)          // Loopback frames
+#define HOSTSIM_WAIT_STARTUP_US     (1000u)         // Reference window of the startup time base test
+
+// Time stamps of HostSim_GetCycles(): Time stamp counter of x86 or the monotonic clock in ns
+#ifndef HOSTSIM_TIME_RDTSC
+    #if defined(__x86_64__) || defined(__i386__)
+        #define HOSTSIM_TIME_RDTSC  true
+    #else
+        #define HOSTSIM_TIME_RDTSC  false
+    #endif
+#endif
+
+// Build of the fault injection harness
+#ifndef HOSTSIM_FAULT_INJECTION
+    #define HOSTSIM_FAULT_INJECTION false
+#endif
+
+// Build with a periodic test that holds off the pass
+#ifndef HOSTSIM_OVERLOAD
+    #define HOSTSIM_OVERLOAD    false
+#endif
+
+// Faults of HostSim_InjectFault()
+typedef enum
+{
+    eHostSim_Fault_RamStuckBit,     // ulParam: Bit from HOSTSIM_SRAM_BASE, stuck at its inverted content
+    eHostSim_Fault_FlashBitFlip,    // ulParam: Bit from the image start
+    eHostSim_Fault_StackCanary,     // ulParam: Guard word, one bit of it flipped
+    eHostSim_Fault_TimeBaseStall,   // System tick stops, the reference clock continues
+    eHostSim_Fault_IoStuckPin,      // ulParam: Port * 8 + pin, stuck at 0
+    eHostSim_Fault_AdcDrift,        // ulParam: Offset of the reference channel in LSB
+    eHostSim_Fault_UartLineErrors,  // Framing error on each received frame
+    eHostSim_Fault_CpuReg,          // ulParam: Failing register group
+    eHostSim_Fault_RamEccDouble,    // ulParam: Bit from HOSTSIM_SRAM_BASE, it and its neighbour flipped behind the ECC
+    eHostSim_Fault_COUNT
+} teHostSim_Fault;
+
+/***************************** global variables ******************************/
+extern u32 HostSim_ulSramSize;          // Simulated SRAM size in bytes
+extern u32 ulAppCodeStart;              // Start address of the application image
+extern u32 ulAppCodeLength;             // Length of the application image
+extern u32 HostSim_ulManifestAdr;       // Address of the flash tile manifest
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void HostSim_Init(u32 ulSramSize, u32 ulFlashSize);
+u8* HostSim_SramPtr(u32 ulAdr);
+const u8* HostSim_FlashPtr(u32 ulAdr);
+u32 HostSim_GetCycles(void);
+u64 HostSim_GetCyclesHz(void);
+u64 HostSim_GetTimeNs(void);
+u32 OS_SW_Timer_GetSystemTickCount(void);
+void HostSim_SetResetReason(u32 ulReason);
+void HostSim_SetLoad(u32 ulPercent);
+bool HostSim_IsEventPending(void);
+u64 HostSim_GetEventStartNs(void);
+void HostSim_AdcSequence(void);
+void HostSim_UartTraffic(void);
+volatile u32* HostSim_StackPtr(u32 ulAdr);
+u32 HostSim_GetStackPointer(void);
+void HostSim_StackLoad(void);
+void HostSim_InjectFault(teHostSim_Fault eFault, u32 ulParam);
+void HostSim_ClearFaults(void);
+u64 HostSim_FaultRead(const volatile void* pvCell, u64 ullValue, u32 ulSize);
+void HostSim_FaultDetected(void);       // Provided by the fault injection harness and the benchmark
+void HostSim_EccInit(void);
+u64 HostSim_EccRead(const volatile u64* pullWord);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOSTSIM_H
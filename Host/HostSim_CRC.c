@@ -0,0 +1,186 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HostSim_CRC
+\details    Host emulation of a DMA / hardware CRC engine for SELFTEST_CRC_ASYNC.
+            A worker thread calculates the started job while the self-test
+            continues, HAL_SelfTest_CRC_Poll() only checks for its completion.
+            The engine state is read without lock like a status register, so
+            polling in a tight loop doesn't starve the worker.
+*/
+
+#include "HostSim.h"
+#include "OS_SelfTest.h"
+
+#include "HAL_SelfTest_CRC.h"
+
+#include <pthread.h>
+
+/****************************************** Defines ******************************************************/
+#define CRC_POLYNOMIAL_REFLECTED    0xEDB88320u     // CRC-32 IEEE 802.3, reflected
+
+typedef enum
+{
+    eEngine_Idle,               // No job, result of the last job read
+    eEngine_Busy,               // Job started, worker calculates
+    eEngine_Done                // Result ready
+} teEngine_State;
+
+
+/****************************************** Variables ****************************************************/
+static pthread_t sWorker;
+static pthread_mutex_t sLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sJobStarted = PTHREAD_COND_INITIALIZER;
+static bool bWorkerRunning = false;
+
+// Job of the engine. The job is handed over with sLock, the state is the status register
+static volatile teEngine_State eState = eEngine_Idle;
+static const u8* pucJobData = NULL;
+static u32 ulJobLength = 0u;
+static u32 ulJobCrc = 0u;
+
+static u32 ulCrcTable[256];
+
+
+/****************************************** local functions *********************************************/
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Worker thread of the emulated engine. Byte wise table CRC, like a
+            simple CRC peripheral fed by DMA.
+\return     never returns
+\param      pvArg - unused
+**********************************************************************************/
+static void* EngineWorker(void* pvArg)
+{
+    (void)pvArg;
+
+    pthread_mutex_lock(&sLock);
+    while(true)
+    {
+        const u8* pucData;
+        u32 ulLength;
+        u32 ulCrc;
+
+        while(eState != eEngine_Busy)
+        {
+            pthread_cond_wait(&sJobStarted, &sLock);
+        }
+        pucData = pucJobData;
+        ulLength = ulJobLength;
+        ulCrc = ulJobCrc;
+        pthread_mutex_unlock(&sLock);
+
+        while(ulLength--)
+        {
+            ulCrc = (ulCrc >> 8u) ^ ulCrcTable[(ulCrc ^ *pucData++) & 0xFFu];
+        }
+
+        ulJobCrc = ulCrc;
+        __atomic_store_n(&eState, eEngine_Done, __ATOMIC_RELEASE);
+        pthread_mutex_lock(&sLock);
+    }
+    return NULL;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Builds the CRC table and starts the worker on the first job
+\return     true when the worker runs
+\param      none
+**********************************************************************************/
+static bool StartWorker(void)
+{
+    if(bWorkerRunning == false)
+    {
+        u32 ulIdx;
+
+        for(ulIdx = 0u; ulIdx < 256u; ulIdx++)
+        {
+            u32 ulCrc = ulIdx;
+            u8 ucBit;
+
+            for(ucBit = 0u; ucBit < 8u; ucBit++)
+            {
+                ulCrc = (ulCrc & 1u) ? ((ulCrc >> 1u) ^ CRC_POLYNOMIAL_REFLECTED) : (ulCrc >> 1u);
+            }
+            ulCrcTable[ulIdx] = ulCrc;
+        }
+
+        bWorkerRunning = (pthread_create(&sWorker, NULL, EngineWorker, NULL) == 0);
+    }
+    return bWorkerRunning;
+}
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts a CRC job on the emulated engine
+\return     OK_STATUS, ERROR_STATUS when the engine is busy or can't be started
+\param      pucData - Start of the data, valid until the job is done
+\param      ulLength - Number of bytes
+\param      ulCrc - CRC start value
+***********************************************************************************/
+u8 HAL_SelfTest_CRC_Start(const u8* pucData, u32 ulLength, u32 ulCrc)
+{
+    u8 ucResult = ERROR_STATUS;
+
+    if(StartWorker())
+    {
+        pthread_mutex_lock(&sLock);
+        if(eState != eEngine_Busy)
+        {
+            pucJobData = pucData;
+            ulJobLength = ulLength;
+            ulJobCrc = ulCrc;
+            __atomic_store_n(&eState, eEngine_Busy, __ATOMIC_RELEASE);
+            pthread_cond_signal(&sJobStarted);
+            ucResult = OK_STATUS;
+        }
+        pthread_mutex_unlock(&sLock);
+    }
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Polls the job of the emulated engine
+\return     PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS or ERROR_STATUS
+            when no job was started
+\param      pulCrc - Continued CRC (not inverted) of the completed job
+***********************************************************************************/
+u8 HAL_SelfTest_CRC_Poll(u32* pulCrc)
+{
+    u8 ucResult = ERROR_STATUS;
+    teEngine_State eActual = __atomic_load_n(&eState, __ATOMIC_ACQUIRE);
+
+    if(eActual == eEngine_Busy)
+    {
+        ucResult = PASS_STILL_TESTING_STATUS;
+    }
+    else if(eActual == eEngine_Done)
+    {
+        *pulCrc = ulJobCrc;
+        __atomic_store_n(&eState, eEngine_Idle, __ATOMIC_RELAXED);
+        ucResult = PASS_COMPLETE_STATUS;
+    }
+    else
+    {
+        // No job started
+    }
+    return ucResult;
+}
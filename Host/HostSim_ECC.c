@@ -0,0 +1,196 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       HostSim_ECC
+\details    Host emulation of an SRAM with hardware ECC for SELFTEST_RAM_MODE_ECC_SCRUB.
+            Each 64bit word of the simulated SRAM has 8 check bits, a SEC-DED
+            Hamming code (72,64): 7 bits select the failing bit, the eighth is
+            the parity over the complete code word. A read with a single bit error
+            returns the corrected word, a read with two failing bits is
+            uncorrectable. Like most ECC logic the read doesn't write the corrected
+            word back, the error stays in the cell.
+            The check bits are written by HAL_MemoryInit_Init(), like the
+            initialization the ECC RAM of a target needs before the first read.
+            Faults come from the stuck bit of eHostSim_Fault_RamStuckBit and the
+            flipped bits of eHostSim_Fault_RamEccDouble.
+*/
+
+#include "HostSim.h"
+#include "OS_SelfTest.h"
+
+#include "HAL_SelfTest_ECC.h"
+
+#include <string.h>
+
+/****************************************** Defines ******************************************************/
+#define ECC_WORD_BITS           (64u)
+#define ECC_CODES               (128u)          // 7 bit syndromes
+#define ECC_NO_BIT              (0xFFu)
+
+
+/****************************************** Variables ****************************************************/
+static u8 aucEccCheck[HOSTSIM_SRAM_MAX_SIZE / sizeof(u64)];     // Check bits of each word
+static u8 aucEccByteCode[sizeof(u64)][256];     // Syndrome of each byte value at each byte position
+static u8 aucEccBit[ECC_CODES];                 // Data bit of a syndrome, ECC_NO_BIT for none
+static bool bEccTables = false;
+static tsSelfTest_EccCounters sEccCounters;
+
+
+/****************************************** local functions *********************************************/
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Builds the code tables. Each data bit gets the next 7 bit code
+            with at least two bits set, single bit codes are the check bits.
+\return     none
+\param      none
+**********************************************************************************/
+static void BuildTables(void)
+{
+    u8 aucBitCode[ECC_WORD_BITS];
+    u32 ulCode = 0u;
+    u32 ulBit;
+    u32 ulByte;
+    u32 ulValue;
+
+    memset(aucEccBit, ECC_NO_BIT, sizeof(aucEccBit));
+    for(ulBit = 0u; ulBit < ECC_WORD_BITS; ulBit++)
+    {
+        do
+        {
+            ulCode++;
+        }while((ulCode & (ulCode - 1u)) == 0u);     // Skip the powers of two
+
+        aucBitCode[ulBit] = (u8)ulCode;
+        aucEccBit[ulCode] = (u8)ulBit;
+    }
+
+    for(ulByte = 0u; ulByte < sizeof(u64); ulByte++)
+    {
+        for(ulValue = 0u; ulValue < 256u; ulValue++)
+        {
+            u8 ucCode = 0u;
+
+            for(ulBit = 0u; ulBit < 8u; ulBit++)
+            {
+                if(ulValue & (1u << ulBit))
+                {
+                    ucCode ^= aucBitCode[(ulByte * 8u) + ulBit];
+                }
+            }
+            aucEccByteCode[ulByte][ulValue] = ucCode;
+        }
+    }
+    bEccTables = true;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      7 bit Hamming code of a word
+\return     The code
+\param      ullData - The word
+**********************************************************************************/
+static u8 HammingCode(u64 ullData)
+{
+    u8 ucCode = 0u;
+    u32 ulByte;
+
+    for(ulByte = 0u; ulByte < sizeof(u64); ulByte++)
+    {
+        ucCode ^= aucEccByteCode[ulByte][(u8)(ullData >> (ulByte * 8u))];
+    }
+    return ucCode;
+}
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Writes the check bits of the complete simulated SRAM from its
+            content and clears the error counters
+\return     none
+\param      none
+***********************************************************************************/
+void HostSim_EccInit(void)
+{
+    const u64* pullWord = (const u64*)HostSim_SramPtr(HOSTSIM_SRAM_BASE);
+    u32 ulWord;
+
+    if(bEccTables == false)
+    {
+        BuildTables();
+    }
+
+    for(ulWord = 0u; ulWord < (HostSim_ulSramSize / sizeof(u64)); ulWord++)
+    {
+        u8 ucCode = HammingCode(pullWord[ulWord]);
+        u8 ucParity = (u8)(__builtin_parityll(pullWord[ulWord]) ^ __builtin_parity(ucCode));
+
+        aucEccCheck[ulWord] = (u8)(ucCode | (ucParity << 7u));   // Even parity of the code word
+    }
+    memset(&sEccCounters, 0, sizeof(sEccCounters));
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Read of a word through the ECC logic, see SELFTEST_ECC_READ.
+            A single bit error is corrected, both error kinds are counted
+            with address and syndrome.
+\return     The word, corrected when possible
+\param      pullWord - Word of the simulated SRAM
+***********************************************************************************/
+u64 HostSim_EccRead(const volatile u64* pullWord)
+{
+    u32 ulOffset = (u32)((const volatile u8*)pullWord - HostSim_SramPtr(HOSTSIM_SRAM_BASE));
+    u64 ullData = HostSim_FaultRead(pullWord, *pullWord, sizeof(u64));
+    u8 ucCheck = aucEccCheck[ulOffset / sizeof(u64)];
+    u8 ucSyndrome = (u8)((HammingCode(ullData) ^ ucCheck) & 0x7Fu);
+    u8 ucParity = (u8)(__builtin_parityll(ullData) ^ __builtin_parity(ucCheck));
+
+    if(ucParity || ucSyndrome)
+    {
+        if(ucParity)
+        {
+            /* Odd number of failing bits: One bit, in the data or in the check bits */
+            if(aucEccBit[ucSyndrome] != ECC_NO_BIT)
+            {
+                ullData ^= (u64)1u << aucEccBit[ucSyndrome];
+            }
+            sEccCounters.ulCorrected++;
+        }
+        else
+        {
+            sEccCounters.ulUncorrected++;       // Two failing bits
+        }
+        sEccCounters.ulAddress = HOSTSIM_SRAM_BASE + ulOffset;
+        sEccCounters.ulSyndrome = (u32)ucSyndrome | ((u32)ucParity << 7u);
+    }
+    return ullData;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Error counters of the emulated ECC logic
+\return     none
+\param      psCounters - Receives the counters
+***********************************************************************************/
+void HAL_SelfTest_ECC_GetCounters(tsSelfTest_EccCounters* psCounters)
+{
+    *psCounters = sEccCounters;
+}
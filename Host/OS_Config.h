@@ -0,0 +1,15 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_Config.h
+\brief      Host build variant of the OS configuration.
+            Only the switches needed by the self-test module are set.
+***********************************************************************************/
+#ifndef OS_CONFIG_H
+#define OS_CONFIG_H
+
+#define USE_OS_SELF_TEST
+
+#endif // OS_CONFIG_H
@@ -0,0 +1,12 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_ErrorDebouncer.h
+\brief      Host build placeholder. The self-test module doesn't use this interface yet.
+***********************************************************************************/
+#ifndef OS_ERRORDEBOUNCER_H
+#define OS_ERRORDEBOUNCER_H
+
+#endif // OS_ERRORDEBOUNCER_H
@@ -0,0 +1,610 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       SelfTest_Benchmark
+\details    Host benchmark of the complete self-test sequence.
+            Runs OS_SelfTest_StartCallback() like the reset handler does. The
+            startup tests call main() again, which then runs the requested number
+            of cyclic sequences and prints the timing of each test and the
+            throughput of the SRAM and flash tests. Finally a software reset is
+            simulated to measure the fast boot.
+
+            Usage: SelfTest_Benchmark [sram bytes] [flash bytes] [sequences] [budget cycles] [load %]
+            A budget of 0 uses OS_SelfTest_Cyclic_Run(), otherwise
+            OS_SelfTest_Cyclic_RunBudget() is called with the given budget.
+            With a load the idle hook mode is used instead: The simulated OS is
+            busy for the given part of each event period and calls the idle hook
+            in the rest of the time, the fallback on each loop.
+
+            The CRC is calculated in the steps by default. Build with
+            -DSELFTEST_CRC_ASYNC=true to benchmark the emulated background engine,
+            its results are not comparable with the ones of a real engine.
+
+            After the report the results are checked: The CRCs against their
+            reference vector, the reading of the wrapped history, the ADC and
+            UART judgement with and without fault and the progress of the last
+            sequence. A failed check or a test stopped on error ends the
+            benchmark with EXIT_FAILURE.
+*/
+
+#include "HostSim.h"
+#include "OS_SelfTest.h"
+#include "OS_SelfTest_ADC.h"
+#include "OS_SelfTest_CRC.h"
+#include "OS_SelfTest_ECC.h"
+#include "OS_SelfTest_Flash.h"
+#include "OS_SelfTest_History.h"
+#include "OS_SelfTest_March.h"
+#include "OS_SelfTest_Stack.h"
+#include "OS_SelfTest_Time.h"
+#include "OS_SelfTest_UART.h"
+#include "SelfTest_Config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/****************************************** Defines ******************************************************/
+#define DEFAULT_SRAM_SIZE       (64u * 1024u)
+#define DEFAULT_FLASH_SIZE      (256u * 1024u)
+#define DEFAULT_SEQUENCES       (20u)
+#define HISTORY_RECORDS         (6u)            // Printed records of the result history
+#define CHECK_ADC_DRIFT         (100u)          // Offset of the reference channel in the ADC check, LSB
+
+typedef struct
+{
+    teSelfTest_ID eTestID;
+    const char* pcName;
+} tsBenchmark_Test;
+
+
+/****************************************** Variables ****************************************************/
+static const tsBenchmark_Test sBenchmarkTests[] =
+{
+    { eSelfTest_ID_CPUREG,      "CPUREG"    },
+    { eSelfTest_ID_CPUPC,       "CPUPC"     },
+    { eSelfTest_ID_TIMEBASE,    "TIMEBASE"  },
+    { eSelfTest_ID_RAM,         "RAM"       },
+    { eSelfTest_ID_STACK,       "STACK"     },
+    { eSelfTest_ID_STACKOVF,    "STACKOVF"  },
+    { eSelfTest_ID_FLASH,       "FLASH"     },
+    { eSelfTest_ID_IO,          "IO"        },
+    { eSelfTest_ID_ADC,         "ADC"       },
+    { eSelfTest_ID_UART,        "UART"      },
+    { eSelfTest_ID_EXIT,        "EXIT"      },
+};
+
+static u8 ucBootCount = 0u;
+static u64 ullBootStart = 0u;
+static u32 ulSramSize = DEFAULT_SRAM_SIZE;
+static u32 ulFlashSize = DEFAULT_FLASH_SIZE;
+static u32 ulSequences = DEFAULT_SEQUENCES;
+static u32 ulBudget = 0u;
+static u32 ulLoad = 0u;
+static bool bIdleMode = false;
+static u32 ulFailedChecks = 0u;
+static const u8 aucCheckVector[] = "123456789";     // Check value of the CRC catalogues
+
+
+/****************************************** local functions *********************************************/
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Name of a test for the report
+\return     Name, "?" for an unknown test
+\param      eTestID - The test
+**********************************************************************************/
+static const char* GetTestName(teSelfTest_ID eTestID)
+{
+    const char* pcName = "?";
+    u8 ucIdx;
+
+    for(ucIdx = 0u; ucIdx < (sizeof(sBenchmarkTests) / sizeof(sBenchmarkTests[0])); ucIdx++)
+    {
+        if(sBenchmarkTests[ucIdx].eTestID == eTestID)
+        {
+            pcName = sBenchmarkTests[ucIdx].pcName;
+        }
+    }
+    return pcName;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Prints the result of a check and counts the failed ones
+\return     none
+\param      bPassed - Result of the check
+\param      pcCheck - Description of the check
+**********************************************************************************/
+static void Check(bool bPassed, const char* pcCheck)
+{
+    printf("  %-40s %s\n", pcCheck, bPassed ? "ok" : "FAILED");
+    if(bPassed == false)
+    {
+        ulFailedChecks++;
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks each polynomial against the check value of "123456789",
+            in one call, continued over two parts and as engine job
+\return     none
+\param      none
+**********************************************************************************/
+static void CheckCrc(void)
+{
+    u32 ulLength = sizeof(aucCheckVector) - 1u;
+    u32 ulCrc = OS_SelfTest_CRC_Calc(aucCheckVector, 4u, CRC_INIT_VALUE);
+    u8 ucStatus;
+
+    Check(~OS_SelfTest_CRC_Calc(aucCheckVector, ulLength, CRC_INIT_VALUE) == 0xCBF43926u, "CRC-32 check value");
+    Check(~OS_SelfTest_CRC_Calc(&aucCheckVector[4], ulLength - 4u, ulCrc) == 0xCBF43926u, "CRC-32 continued over two parts");
+    Check(~OS_SelfTest_CRC_CalcPoly(SELFTEST_CRC_POLY_CRC32C, aucCheckVector, ulLength, CRC_INIT_VALUE) == 0xE3069283u, "CRC-32C check value");
+    Check((~OS_SelfTest_CRC_CalcPoly(SELFTEST_CRC_POLY_CRC16, aucCheckVector, ulLength, CRC_INIT_VALUE & 0xFFFFu) & 0xFFFFu) == 0x906Eu, "CRC-16 check value");
+
+    ulCrc = 0u;
+    ucStatus = OS_SelfTest_CRC_Start(aucCheckVector, ulLength, CRC_INIT_VALUE);
+    while(ucStatus == OK_STATUS)
+    {
+        ucStatus = OS_SelfTest_CRC_Poll(&ulCrc);
+        if(ucStatus == PASS_STILL_TESTING_STATUS)
+        {
+            ucStatus = OK_STATUS;
+        }
+    }
+    Check((ucStatus == PASS_COMPLETE_STATUS) && (~ulCrc == 0xCBF43926u), "CRC-32 job check value");
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks the reading of the wrapped history: A reader behind the
+            oldest record skips ahead to it and reads the following records
+            without gap up to the newest one.
+\return     none
+\param      none
+**********************************************************************************/
+static void CheckHistory(void)
+{
+    u32 ulCount = OS_SelfTest_History_GetCount();
+    u32 ulOldest = (ulCount > SELFTEST_HISTORY_SIZE) ? (ulCount - SELFTEST_HISTORY_SIZE) : 0u;
+    u32 ulNumber = 0u;
+    u32 ulExpected = ulOldest;
+    bool bPassed = true;
+    tsSelfTest_Record sRecord;
+
+    while(OS_SelfTest_History_Read(&ulNumber, &sRecord))
+    {
+        bPassed = bPassed && (sRecord.ulNumber == ulExpected) && (ulNumber == ulExpected + 1u)
+                          && (sRecord.eResultCode == eSelfTest_OK);
+        ulExpected++;
+    }
+    Check(bPassed && (ulExpected == ulCount), (ulCount > SELFTEST_HISTORY_SIZE) ? "History skips ahead after the wrap" : "History read without wrap");
+}
+
+
+#if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Judges all ADC references in the slots of the simulated application
+\return     PASS_COMPLETE_STATUS or ERROR_STATUS of OS_SelfTest_ADC_Poll()
+\param      none
+**********************************************************************************/
+static u8 JudgeAdc(void)
+{
+    u8 ucStatus;
+
+    OS_SelfTest_ADC_Start();
+    do
+    {
+        HostSim_AdcSequence();
+        ucStatus = OS_SelfTest_ADC_Poll();
+    }while(ucStatus == PASS_STILL_TESTING_STATUS);
+
+    return ucStatus;
+}
+#endif
+
+
+#if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Judges the simulated bus traffic with the passive UART test. Each
+            check sees more frames than SELFTEST_UART_MAX_LINE_ERRORS, the
+            CRC pass ratio is judged at least once.
+\return     OK_STATUS or ERROR_STATUS of the first failed check
+\param      none
+**********************************************************************************/
+static u8 JudgeUart(void)
+{
+    u8 ucStatus = OK_STATUS;
+    u32 ulFrames = 0u;
+
+    while((ucStatus == OK_STATUS) && (ulFrames < (2u * SELFTEST_UART_MIN_FRAMES)))
+    {
+        u32 ulFrame;
+
+        for(ulFrame = 0u; ulFrame <= SELFTEST_UART_MAX_LINE_ERRORS; ulFrame++)
+        {
+            HostSim_UartTraffic();
+        }
+        ulFrames += ulFrame;
+        ucStatus = OS_SelfTest_UART_Check();
+    }
+    return ucStatus;
+}
+#endif
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Runs the cyclic sequences and prints the report
+\return     none
+\param      ullBootTime - Duration of the startup tests in ns
+**********************************************************************************/
+static void RunBenchmark(u64 ullBootTime)
+{
+    tsSelfTest_SequenceTiming sSeq;
+    tsSelfTest_Progress sHalf = { 0u };
+    tsSelfTest_Progress sLast = { 0u };
+    bool bHalf = false;
+    bool bProgress = true;
+    double dCyclesPerNs = (double)SELFTEST_TIME_HZ / 1000000000.0;
+    u64 ullCyclicStart;
+    u64 ullCyclicTime;
+    u64 ullMaxYield = 0u;
+    u32 ulCalls = 0u;
+    u8 ucIdx;
+
+    OS_SelfTest_InitCyclic();
+    OS_SelfTest_CRC_ResetThroughput();
+
+    ullCyclicStart = HostSim_GetTimeNs();
+    do
+    {
+        HostSim_AdcSequence();              // Conversion sequence of the application
+        HostSim_UartTraffic();              // Bus traffic of the application
+        HostSim_StackLoad();                // Stack use of the application
+
+        if(bIdleMode)
+        {
+            if(HostSim_IsEventPending() == false)
+            {
+                OS_SelfTest_IdleHook();
+                if(HostSim_IsEventPending())
+                {
+                    /* Time from the event to the return of the idle hook */
+                    u64 ullYield = HostSim_GetTimeNs() - HostSim_GetEventStartNs();
+                    if(ullYield > ullMaxYield) ullMaxYield = ullYield;
+                }
+            }
+            OS_SelfTest_IdleFallback();
+        }
+        else if(ulBudget)
+        {
+            OS_SelfTest_Cyclic_RunBudget(ulBudget);
+        }
+        else
+        {
+            OS_SelfTest_Cyclic_Run();
+        }
+        ulCalls++;
+        OS_SelfTest_GetSequenceTiming(&sSeq);
+
+        /* Progress of the last sequence: Never goes back, in the middle compared with its real end */
+        if(sSeq.ulCount + 1u == ulSequences)
+        {
+            tsSelfTest_Progress sNow;
+
+            OS_SelfTest_GetProgress(&sNow);
+            if((sNow.ulPercent < sLast.ulPercent) || (sNow.ulRamBytes < sLast.ulRamBytes) || (sNow.ulFlashBytes < sLast.ulFlashBytes))
+            {
+                bProgress = false;
+            }
+            sLast = sNow;
+            if((bHalf == false) && (sNow.ulPercent >= 50u))
+            {
+                sHalf = sNow;
+                bHalf = true;
+            }
+        }
+    }while(sSeq.ulCount < ulSequences);
+    ullCyclicTime = HostSim_GetTimeNs() - ullCyclicStart;
+
+    printf("SRAM %u bytes, flash %u bytes, %u sequences, budget %u cycles, %s\n",
+           HostSim_ulSramSize, ulAppCodeLength, ulSequences, ulBudget,
+           (SELFTEST_CRC_ASYNC == true) ? "CRC on the emulated engine" : "CRC in the steps");
+    printf("Startup tests:        %10.1f us\n", (double)ullBootTime / 1000.0);
+    printf("Cyclic sequence:      %10.1f us (max %u ticks, worst period %u ticks)\n",
+           (double)ullCyclicTime / 1000.0 / ulSequences, sSeq.ulMaxDuration, sSeq.ulMaxPeriod);
+    printf("Calls per sequence:   %10.1f\n", (double)ulCalls / ulSequences);
+    printf("Time stamps:          %10.1f MHz%s\n", (double)SELFTEST_TIME_HZ / 1000000.0,
+           (SELFTEST_PROFILING == true) ? "" : ", profiling disabled");
+    if(bIdleMode)
+    {
+        tsSelfTest_IdleStats sIdle;
+
+        OS_SelfTest_GetIdleStats(&sIdle);
+        printf("Idle hook, load %u%%:  %10u idle slices, %u fallback slices, %u yields, max yield %.1f us\n",
+               ulLoad, sIdle.ulIdleSlices, sIdle.ulFallbackSlices, sIdle.ulYields, (double)ullMaxYield / 1000.0);
+    }
+    printf("\n");
+
+    /* Startup tests of the first boot, the savings come from the overlapped flash check */
+    if(SELFTEST_PROFILING == true)
+    {
+        tsSelfTest_StartupTiming sStartup;
+        u64 ullTime = 0u;
+        u64 ullSaving = 0u;
+
+        printf("%-10s %12s %12s\n", "Startup", "Time [us]", "Saving [us]");
+        for(ucIdx = 0u; ucIdx < (sizeof(sBenchmarkTests) / sizeof(sBenchmarkTests[0])); ucIdx++)
+        {
+            if(OS_SelfTest_GetStartupTiming(sBenchmarkTests[ucIdx].eTestID, &sStartup) && sStartup.ulTime)
+            {
+                printf("%-10s %12.1f %12.1f\n", sBenchmarkTests[ucIdx].pcName,
+                       (double)sStartup.ulTime / dCyclesPerNs / 1000.0, (double)sStartup.ulSaving / dCyclesPerNs / 1000.0);
+                ullTime += sStartup.ulTime;
+                ullSaving += sStartup.ulSaving;
+            }
+        }
+        printf("%-10s %12.1f %12.1f%s\n\n", "Sum", (double)ullTime / dCyclesPerNs / 1000.0, (double)ullSaving / dCyclesPerNs / 1000.0,
+               (SELFTEST_STARTUP_OVERLAP == true) ? "" : ", not overlapped");
+    }
+
+    printf("%-10s %10s %12s %12s %12s %14s %8s %12s\n", "Test", "Steps", "Min [cyc]", "Mean [cyc]", "Max [cyc]", "Cyc/sequence", "Misses", "Last [ticks]");
+    for(ucIdx = 0u; ucIdx < (sizeof(sBenchmarkTests) / sizeof(sBenchmarkTests[0])); ucIdx++)
+    {
+        tsSelfTest_TimingStats sStats;
+
+        if(OS_SelfTest_GetTestTiming(sBenchmarkTests[ucIdx].eTestID, &sStats))
+        {
+            printf("%-10s %10u %12u %12u %12u %14.0f %8u %12u\n", sBenchmarkTests[ucIdx].pcName,
+                   sStats.ulCount, sStats.ulMin, sStats.ulMean, sStats.ulMax,
+                   (double)sStats.ulMean * sStats.ulCount / ulSequences,
+                   OS_SelfTest_GetDeadlineMisses(sBenchmarkTests[ucIdx].eTestID),
+                   OS_SelfTest_GetPassTime(sBenchmarkTests[ucIdx].eTestID));
+        }
+    }
+
+    /* Throughput from the time spent in the SRAM and flash steps */
+    {
+        tsSelfTest_TimingStats sRam;
+        tsSelfTest_TimingStats sFlash;
+        double dRamNs;
+        double dFlashNs;
+
+        if(OS_SelfTest_GetTestTiming(eSelfTest_ID_RAM, &sRam) && OS_SelfTest_GetTestTiming(eSelfTest_ID_FLASH, &sFlash))
+        {
+            dRamNs = (double)sRam.ulMean * sRam.ulCount / dCyclesPerNs;
+            dFlashNs = (double)sFlash.ulMean * sFlash.ulCount / dCyclesPerNs;
+
+            printf("\nSRAM march:           %10.1f MB/s\n",
+                   dRamNs > 0.0 ? ((double)(TEST_SRAM_ENDADR - TEST_SRAM_STARTADR + 1u) * ulSequences * 1000.0 / dRamNs) : 0.0);
+            printf("Flash CRC:            %10.1f MB/s (%u bytes/tick)\n",
+                   dFlashNs > 0.0 ? ((double)ulAppCodeLength * ulSequences * 1000.0 / dFlashNs) : 0.0,
+                   OS_SelfTest_CRC_GetBytesPerTick());
+        }
+    }
+
+    /* Interrupt lock windows */
+    {
+        tsSelfTest_LockStats sRamLock;
+        tsSelfTest_LockStats sStackLock;
+
+        if(OS_SelfTest_GetLockTime(eSelfTest_ID_RAM, &sRamLock) && OS_SelfTest_GetLockTime(eSelfTest_ID_STACK, &sStackLock))
+        {
+            printf("\nLongest IRQ lock:     %10u cyc SRAM tile (%u exceeded), %u cyc stack check (%u exceeded), limit %u cyc\n",
+                   sRamLock.ulMaxLock, sRamLock.ulExceeded, sStackLock.ulMaxLock, sStackLock.ulExceeded, sRamLock.ulLimit);
+        }
+    }
+
+    /* ECC scrub of the SRAM */
+    #if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+    {
+        tsSelfTest_EccStatus sEcc;
+
+        OS_SelfTest_ECC_GetStatus(&sEcc);
+        printf("\nECC scrub:            %10u passes, %u corrected ( %u last pass ), %u uncorrectable, last at 0x%08X syndrome 0x%02X\n",
+               sEcc.ulPasses, sEcc.ulCorrected, sEcc.ulLastPassCorrected, sEcc.ulUncorrected, sEcc.ulAddress, sEcc.ulSyndrome);
+    }
+    #endif
+
+    /* High-water mark of the stack */
+    {
+        tsSelfTest_StackUsage sStack;
+
+        if(OS_SelfTest_Stack_GetUsage(&sStack))
+        {
+            printf("\nStack high-water:     %10u of %u bytes used, %u free, %u scans\n",
+                   sStack.ulUsed, sStack.ulSize, sStack.ulFree, sStack.ulScans);
+        }
+    }
+
+    /* Flash regions */
+    {
+        tsSelfTest_FlashRegionStatus sRegion;
+        u32 ulRegion;
+
+        for(ulRegion = 0u; OS_SelfTest_Flash_GetRegionStatus(ulRegion, &sRegion); ulRegion++)
+        {
+            printf("%s%10u checks, last at tick %u\n", (ulRegion == 0u) ? "\nFlash regions:        " : "                      ",
+                   sRegion.ulChecks, sRegion.ulLastCheck);
+        }
+    }
+
+    /* Passive UART test */
+    #if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+    {
+        tsSelfTest_UartStatus sUart;
+
+        OS_SelfTest_UART_GetStatus(&sUart);
+        printf("\nUART (passive):       %10u permille CRC pass, %u line errors, %u loopbacks\n",
+               sUart.ulCrcPermille, sUart.ulLineErrors, sUart.ulLoopbacks);
+    }
+    #endif
+
+    /* Newest records of the result history */
+    {
+        u32 ulCount = OS_SelfTest_History_GetCount();
+        u32 ulNumber = (ulCount > HISTORY_RECORDS) ? (ulCount - HISTORY_RECORDS) : 0u;
+        tsSelfTest_Record sRecord;
+
+        printf("\nHistory (%u records):\n", ulCount);
+        while(OS_SelfTest_History_Read(&ulNumber, &sRecord))
+        {
+            printf("  #%-8u tick %10u %-10s %-5s %8u steps %12u cyc\n", sRecord.ulNumber, sRecord.ulTimestamp,
+                   GetTestName(sRecord.eTestID), (sRecord.eResultCode == eSelfTest_OK) ? "OK" : "ERROR",
+                   sRecord.ulTile, sRecord.ulDuration);
+        }
+    }
+
+    /* Worst-case fault reaction time of one pass */
+    {
+        tsSelfTest_ReactionTime sReaction;
+        bool bMet = OS_SelfTest_GetReactionTime(&sReaction);
+
+        bool bBound = (sReaction.ulCalls != SELFTEST_REACTION_NO_BOUND);
+
+        if(bBound)
+        {
+            printf("\nWorst-case pass:      %10u calls, %u ticks, %.1f us execution\n",
+                   sReaction.ulCalls, sReaction.ulTicks, (double)sReaction.ulExecTime / dCyclesPerNs / 1000.0);
+        }
+        else
+        {
+            printf("\nWorst-case pass:      %10s\n", "no bound");
+        }
+        if(sReaction.ulDeadline || (bMet == false))
+        {
+            printf("Fault reaction time:  %10u ticks, margin %d ticks%s\n",
+                   sReaction.ulDeadline, sReaction.slMargin, bMet ? "" : " EXCEEDED");
+        }
+        #if HOSTSIM_OVERLOAD == true
+        Check((bBound == false) && (bMet == false), "Overloaded pass reports EXCEEDED");
+        #else
+        Check(bMet == (bBound && ((sReaction.ulDeadline == 0u) || (sReaction.ulTicks <= sReaction.ulDeadline))),
+              "Fault reaction time verdict");
+        #endif
+    }
+
+    /* Estimate of the progress API against the real end of the last sequence */
+    if(bHalf)
+    {
+        u32 ulRealRemaining = (sSeq.ulLastDuration > sHalf.ulElapsed) ? (sSeq.ulLastDuration - sHalf.ulElapsed) : 0u;
+
+        printf("Progress at %3u%%:     %10u of %u SRAM bytes, %u of %u flash bytes\n",
+               sHalf.ulPercent, sHalf.ulRamBytes, sHalf.ulRamSize, sHalf.ulFlashBytes, sHalf.ulFlashSize);
+        printf("                      %10u ticks elapsed, %u ticks estimated to go, %u real%s\n",
+               sHalf.ulElapsed, sHalf.ulRemaining, ulRealRemaining, sHalf.bBehind ? ", BEHIND" : "");
+    }
+
+    printf("\nChecks:\n");
+    CheckCrc();
+    CheckHistory();
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+        Check(JudgeAdc() == PASS_COMPLETE_STATUS, "ADC references pass");
+        HostSim_InjectFault(eHostSim_Fault_AdcDrift, CHECK_ADC_DRIFT);
+        Check(JudgeAdc() == ERROR_STATUS, "ADC drift fails");
+        HostSim_ClearFaults();
+    #endif
+    #if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+        Check(JudgeUart() == OK_STATUS, "UART traffic passes");
+        HostSim_InjectFault(eHostSim_Fault_UartLineErrors, 0u);
+        Check(JudgeUart() == ERROR_STATUS, "UART line errors fail");
+        HostSim_ClearFaults();
+    #endif
+    Check(bProgress, "Progress never goes back");
+}
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Entered three times: once from the host like the reset handler, then
+            from OS_SelfTest_StartCallback() when the startup tests passed, and
+            again after the simulated software reset.
+            Only the first call provides arguments, they are kept from the first.
+\return     Doesn't return, the process exits after the report
+\param      argc, argv - See file description
+***********************************************************************************/
+int main(int argc, char* argv[])
+{
+    if(ucBootCount == 0u)
+    {
+        ucBootCount = 1u;
+
+        if(argc > 1) ulSramSize = (u32)strtoul(argv[1], NULL, 0);
+        if(argc > 2) ulFlashSize = (u32)strtoul(argv[2], NULL, 0);
+        if(argc > 3) ulSequences = (u32)strtoul(argv[3], NULL, 0);
+        if(argc > 4) ulBudget = (u32)strtoul(argv[4], NULL, 0);
+        if(argc > 5) { ulLoad = (u32)strtoul(argv[5], NULL, 0); bIdleMode = true; }
+        if(ulSequences == 0u) ulSequences = 1u;
+
+        HostSim_Init(ulSramSize, ulFlashSize);
+        HostSim_SetLoad(ulLoad);
+
+        ullBootStart = HostSim_GetTimeNs();
+        OS_SelfTest_StartCallback();        // Doesn't return, enters main() again
+    }
+
+    else if(ucBootCount == 1u)
+    {
+        ucBootCount = 2u;
+        RunBenchmark(HostSim_GetTimeNs() - ullBootStart);
+
+        /* Software reset after the completed passes */
+        HostSim_SetResetReason(SELFTEST_RESET_SOFTWARE);
+        ullBootStart = HostSim_GetTimeNs();
+        OS_SelfTest_StartCallback();        // Doesn't return, enters main() again
+    }
+    else
+    {
+        printf("\nStartup after reset:  %10.1f us (%s)\n", (double)(HostSim_GetTimeNs() - ullBootStart) / 1000.0,
+               OS_SelfTest_IsFastBoot() ? "fast boot" : "full startup tests");
+    }
+
+    if(ulFailedChecks)
+    {
+        printf("\nFAILED: %u checks\n", ulFailedChecks);
+        exit(EXIT_FAILURE);
+    }
+    exit(EXIT_SUCCESS);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Stop on error of a self test, see SELFTEST_STOP_ON_ERROR.
+            No fault is injected into the benchmark, so each stop fails it.
+\return     Doesn't return
+\param      none
+***********************************************************************************/
+void HostSim_FaultDetected(void)
+{
+    printf("\nFAILED: Self test stopped on error\n");
+    exit(EXIT_FAILURE);
+}
@@ -0,0 +1,152 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       SelfTest_Config.h
+\brief      Host build variant of the self-test configuration.
+            All startup and cyclic tests are enabled and run against the
+*           simulated memories of HostSim.
+***********************************************************************************/
+#ifndef SELFTEST_CONFIG_H
+#define SELFTEST_CONFIG_H
+
+/********************************* includes **********************************/
+
+#include "HostSim.h"
+/***************************** defines / macros ******************************/
+//***** Startup tests *****
+#define SELFTEST_S_ENABLE           1
+#define EXEC_STARTUP_CPUREG         true
+#define EXEC_STARTUP_CPUPC          true
+#define EXEC_STARTUP_RAM            true
+#define EXEC_STARTUP_STACK          true
+#define EXEC_STARTUP_INTERRUPT      true
+#define EXEC_STARTUP_FLASH          true
+#define EXEC_STARTUP_ADC            true
+#define EXEC_STARTUP_UART           true
+#define EXEC_STARTUP_TIMEBASE       true
+
+//***** Cyclic tests *****
+#define EXEC_CYCLIC_CPUREG          true
+#define EXEC_CYCLIC_CPUPC           true
+#define EXEC_CYCLIC_TIMEBASE        true
+#define EXEC_CYCLIC_RAM             true
+#define EXEC_CYCLIC_STACK           true
+#define EXEC_CYCLIC_STACKOVF        true
+#define EXEC_CYCLIC_FLASH           true
+#define EXEC_CYCLIC_IO              true
+#define EXEC_CYCLIC_ADC             true
+#define EXEC_CYCLIC_UART            true
+
+//***** SRAM test *****
+#ifndef TEST_BLOCK_SRAM_SIZE
+    #define TEST_BLOCK_SRAM_SIZE    (1024u)                                             // Tile and save buffer size
+#endif
+#define TEST_BUFFER_STARTADR        (HOSTSIM_SRAM_BASE)                                 // Save buffer at start of SRAM
+#define TEST_SRAM_STARTADR          (TEST_BUFFER_STARTADR + TEST_BLOCK_SRAM_SIZE)
+#define TEST_SRAM_ENDADR            (HOSTSIM_SRAM_BASE + HostSim_ulSramSize - 1u)
+#ifndef SELFTEST_RAM_MODE
+    #define SELFTEST_RAM_MODE       (1u)                                                // SELFTEST_RAM_MODE_TRANSPARENT
+#endif
+#define SELFTEST_MARCH_WORD         u64                                                 // 64bit host
+#define SELFTEST_IRQ_LOCK()                                                             // The simulation has no interrupts
+#define SELFTEST_IRQ_UNLOCK()
+
+//***** ECC scrub, see HostSim_ECC.c *****
+#define SELFTEST_ECC_WORD           u64                                                 // Simulated ECC over 64bit words
+#define SELFTEST_ECC_READ(pWord)    HostSim_EccRead(pWord)
+
+//***** Stack high-water mark *****
+#define SELFTEST_STACK_WATERMARK    true
+#define SELFTEST_STACK_STARTADR     (HOSTSIM_STACK_BASE + (HOSTSIM_STACK_GUARD_WORDS * sizeof(u32)))
+#define SELFTEST_STACK_ENDADR       (HOSTSIM_STACK_BASE + HOSTSIM_STACK_SIZE - 1u)
+#define SELFTEST_STACK_POINTER()    HostSim_GetStackPointer()
+#define SELFTEST_STACK_PTR(ulAdr)   HostSim_StackPtr(ulAdr)
+
+//***** Flash test *****
+#ifndef ST_FLASH_TILE_SIZE
+    #define ST_FLASH_TILE_SIZE      (1024u)
+#endif
+#define ST_FLASH_SEGIDX_S1          (1u)
+#define CRC_INIT_VALUE              (0xFFFFFFFFu)
+#ifndef SELFTEST_FLASH_MODE
+    #define SELFTEST_FLASH_MODE     (2u)                    // SELFTEST_FLASH_MODE_REGIONS
+#endif
+#define SELFTEST_FLASH_MANIFEST_ADR (HostSim_ulManifestAdr)
+#define SELFTEST_FLASH_REGION_COUNT HOSTSIM_REGIONS
+// Bootloader each 50ms, image and calibration data each pass, constant tables each 20ms
+#define SELFTEST_FLASH_REGIONS      {                                                                                           \
+    { HOSTSIM_BOOT_ADR,  HOSTSIM_BOOT_SIZE,  HOSTSIM_REGION_REF_ADR(0u), 50000u, SELFTEST_CRC_POLY_CRC32  },                    \
+    { ulAppCodeStart,    ulAppCodeLength,    HOSTSIM_REGION_REF_ADR(1u), 0u,     SELFTEST_CRC_POLY_CRC32  },                    \
+    { HOSTSIM_CALIB_ADR, HOSTSIM_CALIB_SIZE, HOSTSIM_REGION_REF_ADR(2u), 0u,     SELFTEST_CRC_POLY_CRC16  },                    \
+    { HOSTSIM_CONST_ADR, HOSTSIM_CONST_SIZE, HOSTSIM_REGION_REF_ADR(3u), 20000u, SELFTEST_CRC_POLY_CRC32C } }
+// The engine is emulated by a worker thread. On a host with few cores it competes with the
+// test for the CPU and a pass takes about 10 times longer, so it is benchmarked separately
+#ifndef SELFTEST_CRC_ASYNC
+    #define SELFTEST_CRC_ASYNC      false
+#endif
+#ifndef SELFTEST_STARTUP_OVERLAP
+    #define SELFTEST_STARTUP_OVERLAP    SELFTEST_CRC_ASYNC  // Startup flash check on the engine during the other tests
+#endif
+
+//***** IO test *****
+#define IO_PORTS                    HOSTSIM_IO_PORTS
+#define SELFTEST_IO_MODE            (1u)                    // SELFTEST_IO_MODE_BATCH
+#define SELFTEST_IO_PIN_MASK        (0xFFu)                 // 8bit ports
+#define SELFTEST_IO_SKIP_MASKS      { 0x00u, 0x00u, 0x80u, 0x00u, 0x00u, 0x00u, 0x00u, 0x03u }
+
+//***** Fast boot after a warm reset *****
+#define SELFTEST_FAST_BOOT              true
+#define SELFTEST_NOINIT                             // Static memory of the host process survives a simulated reset
+
+//***** Fault reaction time *****
+#define SELFTEST_TIMEBASE_TEST_TICKS    (100u)      // See TIMEBASE_TEST_TICKS in HostSim.c
+
+//***** Result history *****
+#define SELFTEST_MEMORY_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)    // Readers may run in other threads
+
+//***** Idle hook mode *****
+#define SELFTEST_EVENT_PENDING()    HostSim_IsEventPending()
+#define SELFTEST_IDLE_SLICE_TIME    (20000u)        // Cycles, some us on the host
+
+//***** ADC test in free conversion slots *****
+#define SELFTEST_ADC_MODE           (1u)                    // SELFTEST_ADC_MODE_SLOT
+#define SELFTEST_ADC_REFERENCES     { { HOSTSIM_ADC_CH_VREF, 1489u, 24u }, { HOSTSIM_ADC_CH_VSS, 0u, 8u }, { HOSTSIM_ADC_CH_VDD, 4095u, 8u } }
+#define SELFTEST_ADC_SLOT_TIMEOUT   (2000u)                 // Ticks, some application loops
+
+//***** Passive UART test *****
+#define SELFTEST_UART_MODE          (1u)                    // SELFTEST_UART_MODE_PASSIVE
+#define SELFTEST_UART_TRAFFIC_TIMEOUT   (2000u)             // Ticks
+
+//***** Resumable micro-steps *****
+#define SELFTEST_MICRO_STEPS        true
+#define SELFTEST_CPUREG_SUBSTEPS    HOSTSIM_CPUREG_GROUPS
+#define SELFTEST_STACK_SUBSTEPS     HOSTSIM_STACK_SEGMENTS
+#define SELFTEST_ADC_SUBSTEPS       HOSTSIM_ADC_CHANNELS
+#define SELFTEST_UART_SUBSTEPS      HOSTSIM_UART_PHASES
+
+//***** Overload *****
+#if HOSTSIM_OVERLOAD == true
+    #define SELFTEST_PERIOD_CPUREG  (3u)                    // Ticks, below the 4 calls of the register groups
+#endif
+
+//***** Fault injection *****
+#define SELFTEST_STOP_ON_ERROR()        HostSim_FaultDetected()             // Back into the harness, ends the benchmark
+#if HOSTSIM_FAULT_INJECTION == true
+    #define SELFTEST_MARCH_READ(pCell)  ((SELFTEST_MARCH_WORD)HostSim_FaultRead((pCell), *(pCell), sizeof(*(pCell))))
+#endif
+
+//***** Time stamps *****
+#define SELFTEST_TIME_SOURCE        (2u)                    // SELFTEST_TIME_SOURCE_HOOK
+#define SELFTEST_GET_TIME()         HostSim_GetCycles()     // rdtsc or clock_gettime(), see HOSTSIM_TIME_RDTSC
+#define SELFTEST_TIME_HZ            HostSim_GetCyclesHz()
+#ifndef SELFTEST_PROFILING
+    #define SELFTEST_PROFILING      true
+#endif
+
+//***** Simulation hooks *****
+#define SELFTEST_FLASH_PTR(ulAdr)   HostSim_FlashPtr(ulAdr)
+#define SELFTEST_SRAM_PTR(ulAdr)    HostSim_SramPtr(ulAdr)
+
+#endif // SELFTEST_CONFIG_H
@@ -0,0 +1,446 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       SelfTest_FaultInjection
+\details    Host harness measuring the fault detection latency of the cyclic
+            sequence. Replaces the compile time SET_ERROR_IN_xxx switches of
+            OS_SelfTest.c by faults injected at runtime, see HostSim_InjectFault().
+            After the startup tests one clean pass is run to get the calls of a
+            pass. Then each fault is injected at a random call of a pass into a
+            random location and the sequence is called until a test fails.
+            A failed test returns with HostSim_FaultDetected() into the harness,
+            which logs the calls and reference ticks from the injection, repairs
+            the fault and starts the sequence again.
+            A fault not found within HARNESS_PASS_LIMIT passes counts as missed.
+            Stuck pins are only injected into the tested pins, the ones masked
+            with SELFTEST_IO_SKIP_MASKS are not tested by design.
+            The harness exits with EXIT_FAILURE when a fault was missed.
+
+            Build from the repository root:
+            gcc -O2 -DHOSTSIM_FAULT_INJECTION=true -IHost -I. OS_SelfTest*.c
+                Host/HostSim.c Host/HostSim_CRC.c Host/HostSim_ECC.c Host/SelfTest_FaultInjection.c
+                -o SelfTest_FaultInjection -lpthread
+
+            Usage: SelfTest_FaultInjection [runs per fault] [sram bytes] [flash bytes] [budget cycles]
+            A budget of 0 uses OS_SelfTest_Cyclic_Run(), otherwise
+            OS_SelfTest_Cyclic_RunBudget() is called with the given budget.
+*/
+
+#include "HostSim.h"
+#include "OS_SelfTest.h"
+#include "OS_SelfTest_CRC.h"
+#include "OS_SelfTest_History.h"
+#include "OS_SelfTest_March.h"
+#include "SelfTest_Config.h"
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/****************************************** Defines ******************************************************/
+#define DEFAULT_RUNS            (20u)
+#define DEFAULT_SRAM_SIZE       (64u * 1024u)
+#define DEFAULT_FLASH_SIZE      (256u * 1024u)
+#define HARNESS_PASS_LIMIT      (4u)            // Passes until a fault counts as missed
+#define HARNESS_ADC_DRIFT       (100u)          // LSB, beyond the tolerance of the reference
+#define HARNESS_RANDOM_SEED     (0x2545F491u)
+
+#if HOSTSIM_FAULT_INJECTION != true
+    #error "SelfTest_FaultInjection: build with -DHOSTSIM_FAULT_INJECTION=true"
+#endif
+
+typedef struct
+{
+    teHostSim_Fault eFault;
+    teSelfTest_ID eTestID;          // Test expected to find the fault
+    const char* pcName;
+} tsHarness_Fault;
+
+typedef struct
+{
+    u32 ulDetected;
+    u32 ulMissed;
+    u32 ulOtherTest;                // Found by another than the expected test
+    u32 ulMinCalls;
+    u32 ulMaxCalls;
+    u64 ullSumCalls;
+    u32 ulMinTicks;
+    u32 ulMaxTicks;
+    u64 ullSumTicks;
+} tsHarness_Latency;
+
+
+/****************************************** Variables ****************************************************/
+static const tsHarness_Fault sHarnessFaults[] =
+{
+    { eHostSim_Fault_CpuReg,            eSelfTest_ID_CPUREG,    "CPU register"      },
+    { eHostSim_Fault_TimeBaseStall,     eSelfTest_ID_TIMEBASE,  "Time base stall"   },
+#if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+    { eHostSim_Fault_RamEccDouble,      eSelfTest_ID_RAM,       "RAM ECC 2 bits"    },   // A stuck bit is corrected
+#else
+    { eHostSim_Fault_RamStuckBit,       eSelfTest_ID_RAM,       "RAM stuck bit"     },
+#endif
+    { eHostSim_Fault_StackCanary,       eSelfTest_ID_STACK,     "Stack canary"      },
+    { eHostSim_Fault_FlashBitFlip,      eSelfTest_ID_FLASH,     "Flash bit flip"    },
+    { eHostSim_Fault_IoStuckPin,        eSelfTest_ID_IO,        "IO stuck pin"      },
+    { eHostSim_Fault_AdcDrift,          eSelfTest_ID_ADC,       "ADC drift"         },
+    { eHostSim_Fault_UartLineErrors,    eSelfTest_ID_UART,      "UART line errors"  },
+};
+
+static jmp_buf sHarnessDetected;        // Return point of HostSim_FaultDetected()
+static u8 ucBootCount = 0u;
+static u32 ulRandom = HARNESS_RANDOM_SEED;
+static u32 ulRuns = DEFAULT_RUNS;
+static u32 ulSramSize = DEFAULT_SRAM_SIZE;
+static u32 ulFlashSize = DEFAULT_FLASH_SIZE;
+static u32 ulBudget = 0u;
+static const u32 aulHarnessIoSkipMask[IO_PORTS] = SELFTEST_IO_SKIP_MASKS;
+
+
+/****************************************** local functions *********************************************/
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Pseudo random numbers (xorshift) for the injection points
+\return     Random number
+\param      none
+**********************************************************************************/
+static u32 Random(void)
+{
+    ulRandom ^= ulRandom << 13u;
+    ulRandom ^= ulRandom >> 17u;
+    ulRandom ^= ulRandom << 5u;
+    return ulRandom;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reference time of the harness, independent of a stalled system tick
+\return     Ticks of HOSTSIM_TICK_US
+\param      none
+**********************************************************************************/
+static u32 GetReferenceTicks(void)
+{
+    return (u32)(HostSim_GetTimeNs() / (1000u * HOSTSIM_TICK_US));
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      One loop of the simulated application with one call of the sequence
+\return     none
+\param      none
+**********************************************************************************/
+static void RunCall(void)
+{
+    HostSim_AdcSequence();
+    HostSim_UartTraffic();
+    HostSim_StackLoad();
+
+    if(ulBudget)
+    {
+        OS_SelfTest_Cyclic_RunBudget(ulBudget);
+    }
+    else
+    {
+        OS_SelfTest_Cyclic_Run();
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Random location of a fault
+\return     ulParam of HostSim_InjectFault()
+\param      eFault - The fault
+**********************************************************************************/
+static u32 GetFaultParam(teHostSim_Fault eFault)
+{
+    u32 ulParam = Random();
+
+    if((eFault == eHostSim_Fault_RamStuckBit) || (eFault == eHostSim_Fault_RamEccDouble))
+    {
+        /* Bit in the tested SRAM behind the save buffer */
+        u32 ulTestedSize = TEST_SRAM_ENDADR + 1u - TEST_SRAM_STARTADR;
+        ulParam = (((TEST_SRAM_STARTADR - HOSTSIM_SRAM_BASE) + (ulParam % ulTestedSize)) * 8u) + (Random() % 8u);
+    }
+    else if(eFault == eHostSim_Fault_IoStuckPin)
+    {
+        /* Port * 8 + pin of a tested pin */
+        ulParam %= (IO_PORTS * 8u);
+        while(((SELFTEST_IO_PIN_MASK & ~aulHarnessIoSkipMask[ulParam / 8u]) & (1uL << (ulParam % 8u))) == 0u)
+        {
+            ulParam = Random() % (IO_PORTS * 8u);
+        }
+    }
+    else if(eFault == eHostSim_Fault_AdcDrift)
+    {
+        ulParam = HARNESS_ADC_DRIFT;
+    }
+    return ulParam;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Test which stopped the sequence, from the newest history record
+\return     Test ID, eSelfTest_ID_COUNT without a failed record
+\param      none
+**********************************************************************************/
+static teSelfTest_ID GetFailedTest(void)
+{
+    teSelfTest_ID eTestID = eSelfTest_ID_COUNT;
+    u32 ulCount = OS_SelfTest_History_GetCount();
+    u32 ulNumber = ulCount - 1u;                // Newest record
+    tsSelfTest_Record sRecord;
+
+    if(ulCount && OS_SelfTest_History_Read(&ulNumber, &sRecord) && (sRecord.eResultCode == eSelfTest_ERROR))
+    {
+        eTestID = sRecord.eTestID;
+    }
+    return eTestID;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Calls of one clean pass from a fresh start of the sequence
+\return     Calls
+\param      none
+**********************************************************************************/
+static u32 MeasurePass(void)
+{
+    tsSelfTest_SequenceTiming sSeq;
+    u32 ulCount;
+    u32 ulCalls = 0u;
+
+    OS_SelfTest_InitCyclic();
+    OS_SelfTest_GetSequenceTiming(&sSeq);
+    ulCount = sSeq.ulCount;
+    do
+    {
+        RunCall();
+        ulCalls++;
+        OS_SelfTest_GetSequenceTiming(&sSeq);
+    }while(sSeq.ulCount == ulCount);
+
+    return ulCalls;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Injects a fault at a random call of a pass and calls the sequence
+            until the fault is detected. Repairs the fault afterwards.
+\return     true when detected within HARNESS_PASS_LIMIT passes
+\param      psFault - The fault
+\param      ulPassCalls - Calls of a clean pass
+\param      pulCalls - Receives the calls from the injection to the detection
+\param      pulTicks - Receives the reference ticks of the same time
+**********************************************************************************/
+static bool InjectOnce(const tsHarness_Fault* psFault, u32 ulPassCalls, u32* pulCalls, u32* pulTicks)
+{
+    volatile u32 ulCalls = 0u;          // Both kept over the longjmp()
+    volatile bool bDetected = false;
+    u32 ulWarmUp = Random() % ulPassCalls;
+    u32 ulStartTicks;
+    u32 ulCrc;
+
+    OS_SelfTest_InitCyclic();
+    while(ulWarmUp--)
+    {
+        RunCall();
+    }
+    HostSim_InjectFault(psFault->eFault, GetFaultParam(psFault->eFault));
+    ulStartTicks = GetReferenceTicks();
+
+    if(setjmp(sHarnessDetected) == 0)
+    {
+        while(ulCalls < (HARNESS_PASS_LIMIT * ulPassCalls))
+        {
+            ulCalls++;
+            RunCall();
+        }
+    }
+    else
+    {
+        bDetected = true;
+    }
+    *pulCalls = ulCalls;
+    *pulTicks = GetReferenceTicks() - ulStartTicks;
+
+    /* Repair and let a running CRC job of the aborted pass end */
+    HostSim_ClearFaults();
+    while(OS_SelfTest_CRC_Poll(&ulCrc) == PASS_STILL_TESTING_STATUS)
+    {
+    }
+    return bDetected;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Injects a fault ulRuns times and collects the detection latency
+\return     none
+\param      psFault - The fault
+\param      ulPassCalls - Calls of a clean pass
+\param      psLatency - Receives the latency statistic
+**********************************************************************************/
+static void RunFault(const tsHarness_Fault* psFault, u32 ulPassCalls, tsHarness_Latency* psLatency)
+{
+    u32 ulRun;
+
+    psLatency->ulDetected = 0u;
+    psLatency->ulMissed = 0u;
+    psLatency->ulOtherTest = 0u;
+    psLatency->ulMinCalls = 0xFFFFFFFFu;
+    psLatency->ulMaxCalls = 0u;
+    psLatency->ullSumCalls = 0u;
+    psLatency->ulMinTicks = 0xFFFFFFFFu;
+    psLatency->ulMaxTicks = 0u;
+    psLatency->ullSumTicks = 0u;
+
+    for(ulRun = 0u; ulRun < ulRuns; ulRun++)
+    {
+        u32 ulCalls;
+        u32 ulTicks;
+
+        if(InjectOnce(psFault, ulPassCalls, &ulCalls, &ulTicks) == false)
+        {
+            psLatency->ulMissed++;
+        }
+        else
+        {
+            psLatency->ulDetected++;
+            if(GetFailedTest() != psFault->eTestID) psLatency->ulOtherTest++;
+            if(ulCalls < psLatency->ulMinCalls) psLatency->ulMinCalls = ulCalls;
+            if(ulCalls > psLatency->ulMaxCalls) psLatency->ulMaxCalls = ulCalls;
+            if(ulTicks < psLatency->ulMinTicks) psLatency->ulMinTicks = ulTicks;
+            if(ulTicks > psLatency->ulMaxTicks) psLatency->ulMaxTicks = ulTicks;
+            psLatency->ullSumCalls += ulCalls;
+            psLatency->ullSumTicks += ulTicks;
+        }
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Runs all faults and prints the latencies
+\return     Number of missed faults of all runs
+\param      none
+**********************************************************************************/
+static u32 RunHarness(void)
+{
+    tsSelfTest_ReactionTime sReaction;
+    u32 ulPassCalls = MeasurePass();
+    u32 ulMissed = 0u;
+    u8 ucIdx;
+
+    OS_SelfTest_GetReactionTime(&sReaction);
+
+    printf("SRAM %u bytes, flash %u bytes, budget %u cycles, %u runs per fault\n",
+           HostSim_ulSramSize, ulAppCodeLength, ulBudget, ulRuns);
+    printf("Clean pass:           %10u calls, worst-case pass %u calls, %u ticks\n",
+           ulPassCalls, sReaction.ulCalls, sReaction.ulTicks);
+    if(sReaction.ulDeadline)
+    {
+        printf("Fault reaction time:  %10u ticks\n", sReaction.ulDeadline);
+    }
+    printf("\n%-18s %8s %7s %7s %10s %10s %10s %10s %10s %10s\n", "Fault", "Detected", "Missed", "Other",
+           "Min calls", "Mean calls", "Max calls", "Min ticks", "Mean ticks", "Max ticks");
+
+    for(ucIdx = 0u; ucIdx < (sizeof(sHarnessFaults) / sizeof(sHarnessFaults[0])); ucIdx++)
+    {
+        tsHarness_Latency sLatency;
+
+        RunFault(&sHarnessFaults[ucIdx], ulPassCalls, &sLatency);
+        ulMissed += sLatency.ulMissed;
+        if(sLatency.ulDetected)
+        {
+            printf("%-18s %8u %7u %7u %10u %10u %10u %10u %10u %10u\n", sHarnessFaults[ucIdx].pcName,
+                   sLatency.ulDetected, sLatency.ulMissed, sLatency.ulOtherTest,
+                   sLatency.ulMinCalls, (u32)(sLatency.ullSumCalls / sLatency.ulDetected), sLatency.ulMaxCalls,
+                   sLatency.ulMinTicks, (u32)(sLatency.ullSumTicks / sLatency.ulDetected), sLatency.ulMaxTicks);
+        }
+        else
+        {
+            printf("%-18s %8u %7u\n", sHarnessFaults[ucIdx].pcName, 0u, sLatency.ulMissed);
+        }
+    }
+    return ulMissed;
+}
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Stop on error of the cyclic sequence, see SELFTEST_STOP_ON_ERROR.
+            Returns into InjectOnce().
+\return     Doesn't return
+\param      none
+***********************************************************************************/
+void HostSim_FaultDetected(void)
+{
+    longjmp(sHarnessDetected, 1);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Entered twice: once from the host like the reset handler, then
+            from OS_SelfTest_StartCallback() when the startup tests passed.
+\return     Doesn't return, the process exits after the report with
+            EXIT_FAILURE when a fault was missed
+\param      argc, argv - See file description
+***********************************************************************************/
+int main(int argc, char* argv[])
+{
+    int slExit = EXIT_SUCCESS;
+
+    if(ucBootCount == 0u)
+    {
+        ucBootCount = 1u;
+
+        if(argc > 1) ulRuns = (u32)strtoul(argv[1], NULL, 0);
+        if(argc > 2) ulSramSize = (u32)strtoul(argv[2], NULL, 0);
+        if(argc > 3) ulFlashSize = (u32)strtoul(argv[3], NULL, 0);
+        if(argc > 4) ulBudget = (u32)strtoul(argv[4], NULL, 0);
+        if(ulRuns == 0u) ulRuns = 1u;
+
+        HostSim_Init(ulSramSize, ulFlashSize);
+        OS_SelfTest_StartCallback();        // Doesn't return, enters main() again
+    }
+    else if(RunHarness() != 0u)
+    {
+        printf("\nFAILED: Faults missed\n");
+        slExit = EXIT_FAILURE;
+    }
+    exit(slExit);
+}
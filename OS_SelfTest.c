@@ -12,6 +12,15 @@
 #ifdef USE_OS_SELF_TEST
 
 #include "OS_ErrorDebouncer.h"
+#include "OS_SelfTest_ADC.h"
+#include "OS_SelfTest_CRC.h"
+#include "OS_SelfTest_ECC.h"
+#include "OS_SelfTest_Flash.h"
+#include "OS_SelfTest_History.h"
+#include "OS_SelfTest_March.h"
+#include "OS_SelfTest_Stack.h"
+#include "OS_SelfTest_Time.h"
+#include "OS_SelfTest_UART.h"
 #include "OS_StateManager.h"
 #include "SelfTest_Config.h"
 
@@ -22,11 +31,18 @@
 #include "HAL_SelfTest_UART.h"
 #include "HAL_Timer.h"
 
+#if defined(SELFTEST_FAST_BOOT) && (SELFTEST_FAST_BOOT == true)
+    #include "HAL_SelfTest_Reset.h"
+#endif
+
+#include <stddef.h>
+
 /****************************************** Defines ******************************************************/
 //*******************************************
 //* Defines for error generation in tests   *
 // If error in SelfTests should be generated set the directive to 1
 // For errors in SelfTest_SRAM_March.s file set the apropriate in assembler file too
+// The host simulation injects faults at runtime instead, see Host/SelfTest_FaultInjection.c
 #define SET_ERROR_IN_CPUREG             0       // Set failure during CPU_Reg test
 #define SET_ERROR_IN_CPUPC              0       // Set failure during CPU_PC test
 #define SET_ERROR_IN_INTERRUPT          0       // Set failure during Interrupt test
@@ -39,32 +55,381 @@
 #define SET_ERROR_IN_UART               0       // Set failure during UART test
 
 
-#define SELFTEST_ID_DELTA   10
-
-
-typedef enum                                 // Always seperate additional tests witch SELFTEST_ID_DELTA
-{
-   eSelfTest_ID_INIT   = 0u,                                            // STest init
-   eSelfTest_ID_CPUREG = eSelfTest_ID_INIT + SELFTEST_ID_DELTA,         // STest CPU register
-   eSelfTest_ID_CPUPC = eSelfTest_ID_CPUREG + SELFTEST_ID_DELTA,        // STest CPU program counter
-   eSelfTest_ID_TIMEBASE = eSelfTest_ID_CPUPC + SELFTEST_ID_DELTA,    // STest Timebase test init function
-   eSelfTest_ID_TIMEBASE1,                                              //STest timebase test
-   eSelfTest_ID_RAM0 = eSelfTest_ID_TIMEBASE + SELFTEST_ID_DELTA,     // STest SRAM area
-   eSelfTest_ID_RAM1,                                                   // STest SRAM exec
-   eSelfTest_ID_RAM2,                                                   // STest SRAM exec
-   eSelfTest_ID_STACK = eSelfTest_ID_RAM0 + SELFTEST_ID_DELTA,         // STest STACK exec
-   eSelfTest_ID_STACKOVF = eSelfTest_ID_STACK + SELFTEST_ID_DELTA,     // STest STACK limit exec
-   eSelfTest_ID_FLASH0 = eSelfTest_ID_STACKOVF + SELFTEST_ID_DELTA,     // STest Flash 0
-   eSelfTest_ID_FLASH1,                                                 // STest Flash 1
-   eSelfTest_ID_IO0 = eSelfTest_ID_FLASH0 + SELFTEST_ID_DELTA,          // STest IO
-   eSelfTest_ID_IO1,                                                    // STest IO
-   eSelfTest_ID_UREG0 = eSelfTest_ID_IO0 + SELFTEST_ID_DELTA,           // STest UDB Config Register
-   eSelfTest_ID_UREG1,                                                  // STest UDB Config Register
-   eSelfTest_ID_ADC0 = eSelfTest_ID_UREG0 + SELFTEST_ID_DELTA,          // STest ADC
-   eSelfTest_ID_UART0 = eSelfTest_ID_ADC0 + SELFTEST_ID_DELTA,          // STest UART0
-   eSelfTest_ID_UART1,                                                  // STest Uart1
-   eSelfTest_ID_EXIT = eSelfTest_ID_UART0 + SELFTEST_ID_DELTA,          // STest exit
-}teSelfTest_ID;
+// Reaction on a failed cyclic test, the failed test is already logged.
+// A host simulation may replace it to return into a fault injection harness.
+#ifndef SELFTEST_STOP_ON_ERROR
+    #define SELFTEST_STOP_ON_ERROR()    while(1u)
+#endif
+
+// Limits for the tile sizes adapted in the budgeted run.
+// The SRAM tile can't exceed TEST_BLOCK_SRAM_SIZE because this is the size of the save buffer.
+#ifndef TEST_BLOCK_SRAM_MIN_SIZE
+    #define TEST_BLOCK_SRAM_MIN_SIZE    (TEST_BLOCK_SRAM_SIZE / 4u)
+#endif
+#ifndef ST_FLASH_TILE_MAX_SIZE
+    #define ST_FLASH_TILE_MAX_SIZE      (ST_FLASH_TILE_SIZE * 8u)
+#endif
+
+// Flash tile without budget. A background CRC engine gets the biggest tile, its job doesn't load the CPU.
+#if SELFTEST_CRC_ASYNC == true
+    #define ST_FLASH_TILE_JOB_SIZE      ST_FLASH_TILE_MAX_SIZE
+#else
+    #define ST_FLASH_TILE_JOB_SIZE      ST_FLASH_TILE_SIZE
+#endif
+
+// Interrupt lock around the tests which must not be interrupted.
+// The assembler routines of the HAL lock the interrupts themselves, the transparent
+// March needs the lock of the project ( e.g. __disable_irq() / __enable_irq() ).
+#if ( EXEC_CYCLIC_RAM == true ) && ( SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_TRANSPARENT ) \
+    && ( !defined(SELFTEST_IRQ_LOCK) || !defined(SELFTEST_IRQ_UNLOCK) )
+    #error "SELFTEST_RAM_MODE_TRANSPARENT needs the interrupt lock SELFTEST_IRQ_LOCK() and SELFTEST_IRQ_UNLOCK()"
+#endif
+
+// Longest allowed interrupt lock in SELFTEST_GET_TIME() units, 0 = not limited.
+// The SRAM tiles are split until their lock window fits, down to
+// TEST_BLOCK_SRAM_LOCK_MIN_SIZE. The stack check can't be split, it is only monitored.
+#ifndef SELFTEST_MAX_LOCK_TIME
+    #define SELFTEST_MAX_LOCK_TIME      0u
+#endif
+#if ( SELFTEST_MAX_LOCK_TIME > 0u ) && ( SELFTEST_TIME_SOURCE == SELFTEST_TIME_SOURCE_TICK )
+    #error "SELFTEST_MAX_LOCK_TIME needs a SELFTEST_TIME_SOURCE finer than the 1ms tick"
+#endif
+#ifndef TEST_BLOCK_SRAM_LOCK_MIN_SIZE
+    #define TEST_BLOCK_SRAM_LOCK_MIN_SIZE   (8u * sizeof(u64))
+#endif
+
+// IO test: One port per call with eSelfTest_C_IO() or batches of SELFTEST_IO_BATCH_PORTS
+// ports per call with HAL_SelfTest_IO_CheckPorts(). The batch HAL tests the pins as bitmasks
+// and combines the register accesses of ports in the same register bank.
+// SELFTEST_IO_SKIP_MASKS: Initializer with one mask of untested pins per port.
+#define SELFTEST_IO_MODE_PORT           (0u)
+#define SELFTEST_IO_MODE_BATCH          (1u)
+#ifndef SELFTEST_IO_MODE
+    #define SELFTEST_IO_MODE            SELFTEST_IO_MODE_PORT
+#endif
+#ifndef SELFTEST_IO_BATCH_PORTS
+    #define SELFTEST_IO_BATCH_PORTS     (IO_PORTS)
+#endif
+#ifndef SELFTEST_IO_PIN_MASK
+    #define SELFTEST_IO_PIN_MASK        0xFFFFFFFFu     // Pins of a port
+#endif
+#ifndef SELFTEST_IO_SKIP_MASKS
+    #define SELFTEST_IO_SKIP_MASKS      { 0u }          // No pin skipped
+#endif
+
+// Release periods and deadlines of the cyclic tests in system ticks.
+// Period 0: The test is released again as soon as it has finished.
+// Deadline 0: No deadline monitoring.
+// Tests with a shorter period get the higher priority (rate monotonic), tests
+// without period run in the background when no periodic test is released.
+#ifndef SELFTEST_PERIOD_DEFAULT
+    #define SELFTEST_PERIOD_DEFAULT     0u
+#endif
+#ifndef SELFTEST_DEADLINE_DEFAULT
+    #define SELFTEST_DEADLINE_DEFAULT   0u
+#endif
+#ifndef SELFTEST_PERIOD_CPUREG
+    #define SELFTEST_PERIOD_CPUREG      SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_CPUREG
+    #define SELFTEST_DEADLINE_CPUREG    SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_CPUPC
+    #define SELFTEST_PERIOD_CPUPC       SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_CPUPC
+    #define SELFTEST_DEADLINE_CPUPC     SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_TIMEBASE
+    #define SELFTEST_PERIOD_TIMEBASE    SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_TIMEBASE
+    #define SELFTEST_DEADLINE_TIMEBASE  SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_RAM
+    #define SELFTEST_PERIOD_RAM         SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_RAM
+    #define SELFTEST_DEADLINE_RAM       SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_STACK
+    #define SELFTEST_PERIOD_STACK       SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_STACK
+    #define SELFTEST_DEADLINE_STACK     SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_STACKOVF
+    #define SELFTEST_PERIOD_STACKOVF    SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_STACKOVF
+    #define SELFTEST_DEADLINE_STACKOVF  SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_FLASH
+    #define SELFTEST_PERIOD_FLASH       SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_FLASH
+    #define SELFTEST_DEADLINE_FLASH     SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_IO
+    #define SELFTEST_PERIOD_IO          SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_IO
+    #define SELFTEST_DEADLINE_IO        SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_ADC
+    #define SELFTEST_PERIOD_ADC         SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_ADC
+    #define SELFTEST_DEADLINE_ADC       SELFTEST_DEADLINE_DEFAULT
+#endif
+#ifndef SELFTEST_PERIOD_UART
+    #define SELFTEST_PERIOD_UART        SELFTEST_PERIOD_DEFAULT
+#endif
+#ifndef SELFTEST_DEADLINE_UART
+    #define SELFTEST_DEADLINE_UART      SELFTEST_DEADLINE_DEFAULT
+#endif
+
+// Worst-case fault reaction time of one cyclic pass.
+// SELFTEST_CALL_PERIOD: Ticks between two calls of OS_SelfTest_Cyclic_Run().
+// SELFTEST_TIMEBASE_TEST_TICKS: Ticks the cyclic time base test needs for its result.
+// SELFTEST_CRC_TILE_CALLS: Calls of one flash tile, with SELFTEST_CRC_ASYNC its start
+// and the polls until the engine has finished it.
+// SELFTEST_FAULT_REACTION_TIME: Required fault reaction time in ticks (0 = none).
+// With a declared fault reaction time the build fails when a pass with the smallest
+// tile sizes can't meet it. This needs the sizes of the tested memories as constants:
+// SELFTEST_FRT_SRAM_SIZE ( bytes of TEST_SRAM_STARTADR..TEST_SRAM_ENDADR without the
+// stack skipped by the transparent March, see SELFTEST_RAM_SKIP_SIZE ) and
+// SELFTEST_FRT_FLASH_SIZE ( biggest ulAppCodeLength, with SELFTEST_FLASH_MODE_REGIONS
+// the sum of the region lengths ). With SELFTEST_STACK_WATERMARK SELFTEST_FRT_STACK_SIZE
+// ( bytes of SELFTEST_STACK_STARTADR..SELFTEST_STACK_ENDADR ) is taken from the
+// addresses unless they are only known at link time.
+#ifndef SELFTEST_CALL_PERIOD
+    #define SELFTEST_CALL_PERIOD            1u
+#endif
+#ifndef SELFTEST_TIMEBASE_TEST_TICKS
+    #define SELFTEST_TIMEBASE_TEST_TICKS    0u
+#endif
+#ifndef SELFTEST_CRC_TILE_CALLS
+    #define SELFTEST_CRC_TILE_CALLS         ((SELFTEST_CRC_ASYNC == true) ? 2u : 1u)
+#endif
+#ifndef SELFTEST_FAULT_REACTION_TIME
+    #define SELFTEST_FAULT_REACTION_TIME    0u
+#endif
+
+#define SELFTEST_DIV_CEIL(ulA, ulB)         (((ulA) + (ulB) - 1u) / (ulB))
+
+// Resumable micro-steps: The CPU register, stack, ADC and UART tests are called through
+// the step variants of their HAL ( HAL_SelfTest_xxx_Step(ulSubStep) ). Each call tests
+// one register group, stack segment, ADC channel or UART phase and returns
+// PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS after the last sub-step or ERROR_STATUS.
+// Without it the complete test runs in one call. SELFTEST_xxx_SUBSTEPS are the sub-steps
+// of the HAL, only used for the fault reaction time.
+#ifndef SELFTEST_MICRO_STEPS
+    #define SELFTEST_MICRO_STEPS            false
+#endif
+#ifndef SELFTEST_CPUREG_SUBSTEPS
+    #define SELFTEST_CPUREG_SUBSTEPS        1u
+#endif
+#ifndef SELFTEST_STACK_SUBSTEPS
+    #define SELFTEST_STACK_SUBSTEPS         1u
+#endif
+#ifndef SELFTEST_ADC_SUBSTEPS
+    #define SELFTEST_ADC_SUBSTEPS           1u
+#endif
+#ifndef SELFTEST_UART_SUBSTEPS
+    #define SELFTEST_UART_SUBSTEPS          1u
+#endif
+#define SELFTEST_MICRO_CALLS(ulSubSteps)    ((SELFTEST_MICRO_STEPS == true) ? (u32)(ulSubSteps) : 1u)
+
+// Calls of a wait for ulTicks at one call per SELFTEST_CALL_PERIOD. At run time the
+// call rate measured by the time base test is used when it is faster.
+#define SELFTEST_WAIT_CALLS(ulTicks)        SELFTEST_DIV_CEIL((u32)(ulTicks), SELFTEST_CALL_PERIOD)
+
+// Runs of a test within ulTicks: A test with a period is released again after each
+// period (rate monotonic), a test without period runs once per pass.
+#define SELFTEST_RUNS(ulTicks, ulPeriod)    (((ulPeriod) > 0u) ? SELFTEST_DIV_CEIL((u64)(ulTicks), (ulPeriod)) : 1u)
+#define SELFTEST_RTA_ROUNDS                 32u     // Iterations of the pass time at run time
+
+// Worst-case number of calls of one run of each test. One step per call with the
+// smallest tile sizes, a budget or the lock limit may shrink the tiles down to them.
+// Phase 0 of SRAM, flash and time base costs an own call. fnWait converts the wait
+// of the time base and ADC test into calls.
+#define SELFTEST_CALLS_CPUREG               (EXEC_CYCLIC_CPUREG ? SELFTEST_MICRO_CALLS(SELFTEST_CPUREG_SUBSTEPS) : 0u)
+#define SELFTEST_CALLS_CPUPC                (EXEC_CYCLIC_CPUPC ? 1u : 0u)
+#define SELFTEST_CALLS_TIMEBASE(fnWait)     (EXEC_CYCLIC_TIMEBASE ? (2u + fnWait(SELFTEST_TIMEBASE_TEST_TICKS)) : 0u)
+#if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+    #define SELFTEST_SRAM_TILE_MIN_SIZE     SELFTEST_ECC_TILE_MIN_SIZE
+#elif SELFTEST_MAX_LOCK_TIME > 0u
+    #define SELFTEST_SRAM_TILE_MIN_SIZE     ((TEST_BLOCK_SRAM_LOCK_MIN_SIZE < TEST_BLOCK_SRAM_MIN_SIZE) ? TEST_BLOCK_SRAM_LOCK_MIN_SIZE : TEST_BLOCK_SRAM_MIN_SIZE)
+#else
+    #define SELFTEST_SRAM_TILE_MIN_SIZE     TEST_BLOCK_SRAM_MIN_SIZE
+#endif
+
+// The transparent March is C code on the stack and must not invert its own frame: When the
+// stack SELFTEST_STACK_STARTADR..SELFTEST_STACK_ENDADR lies within the tested SRAM the tile
+// walk steps over it. SELFTEST_RAM_SKIP_SIZE are the skipped bytes, the tile in front of
+// the stack is cut and costs one more call.
+#if ( SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_TRANSPARENT ) && defined(SELFTEST_STACK_STARTADR) && defined(SELFTEST_STACK_ENDADR)
+    #define SELFTEST_RAM_SKIP_STACK         true
+    #define SELFTEST_RAM_SKIP_START         ((SELFTEST_STACK_STARTADR > TEST_SRAM_STARTADR) ? SELFTEST_STACK_STARTADR : TEST_SRAM_STARTADR)
+    #define SELFTEST_RAM_SKIP_END           ((SELFTEST_STACK_ENDADR < TEST_SRAM_ENDADR) ? SELFTEST_STACK_ENDADR : TEST_SRAM_ENDADR)
+    #define SELFTEST_RAM_SKIP_SIZE          ((SELFTEST_RAM_SKIP_END >= SELFTEST_RAM_SKIP_START) ? (SELFTEST_RAM_SKIP_END + 1u - SELFTEST_RAM_SKIP_START) : 0u)
+#else
+    #define SELFTEST_RAM_SKIP_STACK         false
+    #define SELFTEST_RAM_SKIP_SIZE          0u
+#endif
+#define SELFTEST_CALLS_RAM(ulSramSize)      (EXEC_CYCLIC_RAM ? (1u + SELFTEST_DIV_CEIL(ulSramSize, SELFTEST_SRAM_TILE_MIN_SIZE)  \
+                                                                + ((SELFTEST_RAM_SKIP_SIZE > 0u) ? 1u : 0u)) : 0u)
+#if SELFTEST_STACK_WATERMARK == true
+    // The scan reads the unused stack, at most all of it, SELFTEST_STACK_SCAN_WORDS words per call
+    #define SELFTEST_CALLS_STACK_SCAN(ulFree)   (1u + ((ulFree) / (SELFTEST_STACK_SCAN_WORDS * sizeof(u32))))
+    #ifndef SELFTEST_FRT_STACK_SIZE
+        #define SELFTEST_FRT_STACK_SIZE     (SELFTEST_STACK_ENDADR + 1u - SELFTEST_STACK_STARTADR)
+    #endif
+#else
+    #define SELFTEST_CALLS_STACK_SCAN(ulFree)   0u
+    #define SELFTEST_FRT_STACK_SIZE         0u
+#endif
+#define SELFTEST_CALLS_STACK(ulFree)        (EXEC_CYCLIC_STACK ? (SELFTEST_MICRO_CALLS(SELFTEST_STACK_SUBSTEPS) + SELFTEST_CALLS_STACK_SCAN(ulFree)) : 0u)
+#define SELFTEST_CALLS_STACKOVF             (EXEC_CYCLIC_STACKOVF ? 1u : 0u)
+#if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    // A short last tile per region
+    #define SELFTEST_CALLS_FLASH(ulFlashSize)   (EXEC_CYCLIC_FLASH ? (1u + (SELFTEST_DIV_CEIL(ulFlashSize, ST_FLASH_TILE_SIZE) + SELFTEST_FLASH_REGION_COUNT) * SELFTEST_CRC_TILE_CALLS) : 0u)
+#else
+    #define SELFTEST_CALLS_FLASH(ulFlashSize)   (EXEC_CYCLIC_FLASH ? (1u + SELFTEST_DIV_CEIL(ulFlashSize, ST_FLASH_TILE_SIZE) * SELFTEST_CRC_TILE_CALLS) : 0u)
+#endif
+#if SELFTEST_IO_MODE == SELFTEST_IO_MODE_BATCH
+    #define SELFTEST_CALLS_IO               (EXEC_CYCLIC_IO ? SELFTEST_DIV_CEIL((u32)(IO_PORTS), SELFTEST_IO_BATCH_PORTS) : 0u)
+#else
+    #define SELFTEST_CALLS_IO               (EXEC_CYCLIC_IO ? (u32)(IO_PORTS) : 0u)
+#endif
+#if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+    // Each reference waits at most SELFTEST_ADC_SLOT_TIMEOUT ticks for its conversion
+    #define SELFTEST_CALLS_ADC(fnWait)      (EXEC_CYCLIC_ADC ? (1u + (u32)SELFTEST_ADC_REFERENCE_COUNT * (1u + fnWait(SELFTEST_ADC_SLOT_TIMEOUT))) : 0u)
+#else
+    #define SELFTEST_CALLS_ADC(fnWait)      (EXEC_CYCLIC_ADC ? SELFTEST_MICRO_CALLS(SELFTEST_ADC_SUBSTEPS) : 0u)
+#endif
+#if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+    #define SELFTEST_CALLS_UART             (EXEC_CYCLIC_UART ? 1u : 0u)
+#else
+    #define SELFTEST_CALLS_UART             (EXEC_CYCLIC_UART ? SELFTEST_MICRO_CALLS(SELFTEST_UART_SUBSTEPS) : 0u)
+#endif
+#define SELFTEST_CALLS_EXIT                 1u
+
+// Worst-case calls of the tests released within ulTicks, the periodic tests with all
+// their runs. A pass ends within ulTicks when these calls fit into ulTicks.
+#define SELFTEST_CALLS_PASS(ulSramSize, ulFlashSize, ulStackFree, ulTicks)                                      \
+    ( SELFTEST_CALLS_CPUREG * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_CPUREG)                                    \
+    + SELFTEST_CALLS_CPUPC * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_CPUPC)                                      \
+    + SELFTEST_CALLS_TIMEBASE(SELFTEST_WAIT_CALLS) * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_TIMEBASE)            \
+    + SELFTEST_CALLS_RAM(ulSramSize) * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_RAM)                              \
+    + SELFTEST_CALLS_STACK(ulStackFree) * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_STACK)                         \
+    + SELFTEST_CALLS_STACKOVF * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_STACKOVF)                                \
+    + SELFTEST_CALLS_FLASH(ulFlashSize) * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_FLASH)                         \
+    + SELFTEST_CALLS_IO * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_IO)                                            \
+    + SELFTEST_CALLS_ADC(SELFTEST_WAIT_CALLS) * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_ADC)                      \
+    + SELFTEST_CALLS_UART * SELFTEST_RUNS(ulTicks, SELFTEST_PERIOD_UART)                                        \
+    + SELFTEST_CALLS_EXIT )
+
+// Fast boot: After a qualified warm reset only the CPU and stack tests run on startup,
+// the other startup tests are deferred to the cyclic sequence. A warm reset is qualified
+// when its cause is in SELFTEST_WARM_RESET_CAUSES, the boot record in no-init RAM is
+// valid and a complete cyclic pass has passed since the last boot. Any other cause,
+// also an unknown one, forces the full startup tests. After SELFTEST_WARM_BOOT_MAX
+// fast boots in a row the full startup tests are forced as well.
+#ifndef SELFTEST_FAST_BOOT
+    #define SELFTEST_FAST_BOOT              false
+#endif
+#ifndef SELFTEST_WARM_RESET_CAUSES
+    #define SELFTEST_WARM_RESET_CAUSES      (SELFTEST_RESET_SOFTWARE | SELFTEST_RESET_WATCHDOG)
+#endif
+#ifndef SELFTEST_WARM_BOOT_MAX
+    #define SELFTEST_WARM_BOOT_MAX          3u
+#endif
+// Placement of the boot record in RAM which is neither tested nor initialized on startup
+#ifndef SELFTEST_NOINIT
+    #define SELFTEST_NOINIT                 __attribute__((section(".noinit")))
+#endif
+#define SELFTEST_BOOT_SIGNATURE             0x53544254u     // "STBT"
+
+// A startup test is skipped on a fast boot only when its cyclic counterpart is enabled
+#define SELFTEST_RUN_STARTUP(bFastBoot, bCyclic)    (((bFastBoot) == false) || ((bCyclic) != true))
+
+// Overlapped startup: After HAL_MemoryInit_Init() the flash CRC of the image is started as
+// a job of the CRC engine, the interrupt, ADC, UART and time base tests run on the CPU
+// meanwhile and the result of the flash check is collected after them. The tests before
+// HAL_MemoryInit_Init() keep their order, the initialization would drop a running job.
+// Only a background engine ( SELFTEST_CRC_ASYNC ) shortens the boot.
+#ifndef SELFTEST_STARTUP_OVERLAP
+    #define SELFTEST_STARTUP_OVERLAP        SELFTEST_CRC_ASYNC
+#endif
+
+// Time stamps of the startup tests, see OS_SelfTest_GetStartupTiming()
+#if SELFTEST_PROFILING == true
+    #define SELFTEST_STARTUP_TIME()         SELFTEST_GET_TIME()
+#else
+    #define SELFTEST_STARTUP_TIME()         0u
+#endif
+
+// Idle hook mode: OS_SelfTest_IdleHook() is called from the idle hook of the OS and runs
+// slices of SELFTEST_IDLE_SLICE_TIME while no event is pending. An event is detected
+// between the steps, so the hook returns within one slice ( plus the longest step which
+// can't be split ). OS_SelfTest_IdleFallback(), called from a periodic task, runs one
+// slice when the idle hook had no slice for SELFTEST_IDLE_FALLBACK_TICKS.
+#ifndef SELFTEST_EVENT_PENDING
+    #define SELFTEST_EVENT_PENDING()        (false)         // Event query of the OS
+#endif
+#ifndef SELFTEST_IDLE_SLICE_TIME
+    #define SELFTEST_IDLE_SLICE_TIME        2000u           // SELFTEST_GET_TIME() units
+#endif
+#ifndef SELFTEST_IDLE_MAX_SLICES
+    #define SELFTEST_IDLE_MAX_SLICES        16u             // Slices per call, then back to the OS
+#endif
+#ifndef SELFTEST_IDLE_FALLBACK_TICKS
+    #define SELFTEST_IDLE_FALLBACK_TICKS    100u            // Ticks without slice until the fallback runs
+#endif
+#ifndef SELFTEST_IDLE_FALLBACK_TIME
+    #define SELFTEST_IDLE_FALLBACK_TIME     SELFTEST_IDLE_SLICE_TIME
+#endif
+
+// Number of steps in the sequence: exit and the enabled cyclic tests
+#define SELFTEST_STEP_COUNT     ( 1u + EXEC_CYCLIC_CPUREG + EXEC_CYCLIC_CPUPC + EXEC_CYCLIC_TIMEBASE \
+                                + EXEC_CYCLIC_RAM + EXEC_CYCLIC_STACK + EXEC_CYCLIC_STACKOVF \
+                                + EXEC_CYCLIC_FLASH + EXEC_CYCLIC_IO + EXEC_CYCLIC_ADC + EXEC_CYCLIC_UART )
+
+#define SELFTEST_EXIT_IDX       (SELFTEST_STEP_COUNT - 1u)                      // Exit is the last step
+#define SELFTEST_PASS_MASK      ((1uL << SELFTEST_EXIT_IDX) - 1u)              // All tests finished once
+
+#define SELFTEST_ARRAY_SIZE(Array)          (sizeof(Array) / sizeof((Array)[0]))
+
+// Compile time check, fails with a negative array size
+#define SELFTEST_STATIC_ASSERT(bCond, Name) typedef char SelfTest_StaticAssert_##Name[(bCond) ? 1 : -1]
+
+//***** Result of a sequence step *********
+//
+typedef enum
+{
+    eSelfTest_Step_Pending,             // Test not finished, call the step again
+    eSelfTest_Step_Done,                // Test finished, continue with the next step
+    eSelfTest_Step_Error                // Test failed
+} teSelfTest_StepResult;
+
+//***** Descriptor of a sequence step *********
+//
+typedef teSelfTest_StepResult (*pfnSelfTest_Step)(void);
+
+// Resumable HAL test, called with the index of the sub-step
+typedef u8 (*pfnSelfTest_MicroStep)(u32 ulSubStep);
+
+typedef struct
+{
+    teSelfTest_ID eTestID;              // Test executed by this step
+    pfnSelfTest_Step pfnStep;           // Function of the test
+    u32 ulPeriod;                       // Release period in system ticks
+    u32 ulDeadline;                     // Allowed ticks from release to completion
+} tsSelfTest_StepDesc;
+
+
 
 //***** Structure for cyclic test *********
 //
@@ -77,6 +442,12 @@ typedef struct
     u32 ulTestResult;
     teSelfTest_ID eTestID;
     teSelfTest_ResultCode eResultCode;
+    u8 ucPhase;                         // Sub state of a test, 0 on entry
+    u32 ulRelease;                      // Time tick of the actual release
+    u32 ulDeadlineMisses;               // Number of completions after the deadline
+    u32 ulTile;                         // Executed steps of the actual test run
+    u32 ulRunTime;                      // Execution time of the pending steps
+    u32 ulStart;                        // Time tick of the first step of the actual test run
 } tsSelfTest_State;
 
 //*** Structure for cyclic test logging *****
@@ -89,25 +460,100 @@ typedef struct
 
 typedef struct
 {
+        u32 ulSequence;                 // Odd while the results are written, see OS_SelfTest_History.h
         tsSelfTest_LogVal sActualResult;
         tsSelfTest_LogVal sLastResult;
 } tsSelfTest_LOG;
 
+//*** Boot record in no-init RAM, survives a warm reset *****
+//
+typedef struct
+{
+    u32 ulSignature;        // SELFTEST_BOOT_SIGNATURE when written by this module
+    u32 ulResetReason;      // Reset cause of the last boot
+    u32 ulWarmBoots;        // Fast boots in a row
+    u32 ulPassCount;        // Complete cyclic passes since the last boot
+    u32 ulPassedTests;      // Tests of the last complete pass, one bit per teSelfTest_ID
+    u32 ulPassTime;         // Duration of the last complete pass in ticks
+    u32 ulFlashTile;        // Next tile of the manifest flash test
+    u32 ulChecksum;         // Checksum of the fields above
+} tsSelfTest_BootRecord;
+
+//*** Structure for the tile size adaption *****
+//
+typedef struct
+{
+    u32 ulSize;         // Size of the last executed tile
+    u32 ulCost;         // Measured time of the last executed tile
+} tsSelfTest_Tile;
+
+//*** Structure for the execution time statistic of a test *****
+//
+typedef struct
+{
+    u32 ulMin;          // Shortest step
+    u32 ulMax;          // Longest step
+    u32 ulSum;          // Sum of the step times for the mean value
+    u32 ulSumCount;     // Number of steps in ulSum
+    u32 ulCount;        // Number of executed steps
+} tsSelfTest_TimeStat;
+
+//*** Structure for the interrupt lock statistic of a test *****
+//
+typedef struct
+{
+    u32 ulMax;          // Longest lock window
+    u32 ulExceeded;     // Lock windows longer than SELFTEST_MAX_LOCK_TIME
+} tsSelfTest_LockStat;
+
 
 
 
 
 /****************************************** Variables ****************************************************/
 static volatile u32 ulResetReason = 0;
+static bool bSfT_FastBoot = false;
+
+#if SELFTEST_FAST_BOOT == true
+// Boot record, not cleared by HAL_MemoryInit_Init()
+static SELFTEST_NOINIT tsSelfTest_BootRecord sSfT_BootRecord;
+#endif
 
 // Timertick counter
 static u32 ulSfT_Time_0 = 0;   //Self-Test start time tick
 static u32 ulSfT_Time_1 = 0;   //Duration result for the cyclic self test
 
-
-// Test State controlling the Sequence of Selftests
-static tsSelfTest_State sSfT_State;
-static tsSelfTest_State *psSfT_State  = &sSfT_State;
+// Execution time statistics
+#if SELFTEST_PROFILING == true
+static tsSelfTest_TimeStat sSfT_TimeStat[eSelfTest_ID_COUNT];
+static tsSelfTest_LockStat sSfT_LockStat[eSelfTest_ID_COUNT];
+#endif
+static tsSelfTest_SequenceTiming sSfT_SeqTiming;
+static u32 ulSfT_LastCompletion = 0;   //Time tick of the last completed sequence
+static u32 ulSfT_PassTime[eSelfTest_ID_COUNT];  //Ticks of the last complete run of each test
+static u32 ulSfT_PassSteps[eSelfTest_ID_COUNT]; //Steps of the last complete run of each test
+static u32 ulSfT_RateCalls = 0u;                //Fastest call rate measured by the time base test:
+static u32 ulSfT_RateTicks = 0u;                //ulSfT_RateCalls calls in ulSfT_RateTicks ticks, 0 = none
+static u32 ulSfT_PassWork[eSelfTest_ID_COUNT];  //Execution time of the last complete run, its steps without SELFTEST_PROFILING
+static u32 ulSfT_WeightWork[eSelfTest_ID_COUNT];    //Progress weights of the running pass, fixed at its start:
+static u32 ulSfT_WeightSteps[eSelfTest_ID_COUNT];   //ulSfT_PassWork and ulSfT_PassSteps or the worst-case calls
+
+// Startup tests: Timing of each test and the flash check running in the background
+static tsSelfTest_StartupTiming sSfT_StartupTiming[eSelfTest_ID_COUNT];
+#if SELFTEST_S_ENABLE && ( EXEC_STARTUP_FLASH == true ) && ( SELFTEST_STARTUP_OVERLAP == true )
+static u8 ucSfT_StartupFlash = OK_STATUS;       // PASS_STILL_TESTING_STATUS while the job runs
+static u32 ulSfT_StartupCrc = 0u;               // Result of the job
+static u32 ulSfT_StartupFlashStart = 0u;        // Time stamp of the job start
+#endif
+
+
+// Test State controlling the Sequence of Selftests. Each step has its own state, so a
+// test can be interrupted by a test with a higher priority and resumed afterwards.
+static tsSelfTest_State sSfT_State[SELFTEST_STEP_COUNT];
+static tsSelfTest_State *psSfT_State  = &sSfT_State[0];
+
+// Steps finished in the actual pass, one bit per step index
+static u32 ulSfT_PassMask = 0u;
 
 
 // Result set containing the test results of the last test executed,
@@ -115,7 +561,40 @@ static tsSelfTest_State *psSfT_State  = &sSfT_State;
 static tsSelfTest_LOG sSfT_Log;
 static tsSelfTest_LOG *psSfT_Log = &sSfT_Log;
 
+// Budgeted run: remaining time of the actual slice (0 = no budget, fixed tile sizes)
+// and the estimated cost of each test group
+static u32 ulSfT_BudgetLeft = 0u;
+static u32 ulSfT_StepCost[eSelfTest_ID_COUNT];
+
+// Time stamp of a measurement, only taken when the measurement is used
+#define SELFTEST_STAMP(bUsed)       ((bUsed) ? SELFTEST_GET_TIME() : 0u)
+
+// Idle hook mode: Time tick of the last slice and the slice statistic
+static u32 ulSfT_LastSlice = 0u;
+static tsSelfTest_IdleStats sSfT_IdleStats;
+
+// Tile adaption for SRAM march and flash CRC
+#if EXEC_CYCLIC_RAM == true
+static tsSelfTest_Tile sSfT_RamTile;
+#endif
+#if EXEC_CYCLIC_FLASH == true
+static tsSelfTest_Tile sSfT_FlashTile[SELFTEST_CRC_POLY_COUNT];     // The polynomials differ much in speed
+#if SELFTEST_CRC_ASYNC == true
+static u32 ulSfT_FlashJobStart = 0u;                                // Time of the start of the running CRC job
+static u32 ulSfT_FlashJobSize = 0u;                                 // Bytes of the running CRC job, 0 = none
+#endif
+#endif
+
 // Variables used in flash tests
+#if ( EXEC_CYCLIC_IO == true ) && ( SELFTEST_IO_MODE == SELFTEST_IO_MODE_BATCH )
+// Variables used in the IO test. The failed pins are kept for the diagnosis after a stop
+static const u32 aulSfT_IoSkipMask[IO_PORTS] = SELFTEST_IO_SKIP_MASKS;
+static u32 aulSfT_IoFailMask[IO_PORTS];
+#endif
+
+#if ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_MANIFEST )
+static const tsSelfTest_FlashManifest* psSfT_FlashManifest = NULL;   // Validated in phase 0 of each pass
+#endif
 extern u32 ulAppCodeLength;
 extern u32 ulAppCodeStart;
 
@@ -127,6 +606,11 @@ extern u32 ulAppCodeStart;
 
 extern u32 OS_SW_Timer_GetSystemTickCount( void );
 extern int main(void);
+static void RecordSequence(void);
+static void FixProgressWeights(void);
+#if SELFTEST_FAST_BOOT == true
+static u32 GetSequenceTests(void);
+#endif
 /****************************************** local functions *********************************************/
 
 
@@ -136,489 +620,2551 @@ extern int main(void);
 /*!
 \author     Kraemer E.
 \date       13.04.2021
-\brief      Logs the state of the self-test
-\return     eSelfTest_OK
-\param      eNextID - The next self-test step
+\brief      Logs the state of the self-test. The log is protected by a
+            sequence counter like a history slot, so a reader ( debugger,
+            diagnostic task ) never sees a torn result.
+\return     none
 \param      eResultCode - The result code of the current step
 **********************************************************************************/
-void TestLog( teSelfTest_ID eNextID, teSelfTest_ResultCode eResultCode)
+static void TestLog(teSelfTest_ResultCode eResultCode)
 {
+    const u32 ulSequence = psSfT_Log->ulSequence;
+
+    psSfT_Log->ulSequence = ulSequence + 1u;                          // Odd: A reader retries
+    SELFTEST_MEMORY_BARRIER();
     psSfT_Log->sActualResult.eTestID = psSfT_State->eTestID;
     psSfT_Log->sActualResult.eResultCode = eResultCode;
-    psSfT_Log->sLastResult = psSfT_Log->sActualResult;                // Shift actual result to old, new result to last active
-    psSfT_State->eTestID = eNextID;
-    psSfT_Log->sActualResult.eResultCode = eSelfTest_NotExecuted;
+    if(eResultCode != eSelfTest_ERROR)                                // A failed test stays the actual one
+    {
+        psSfT_Log->sLastResult = psSfT_Log->sActualResult;            // Shift actual result to old, new result to last active
+        psSfT_Log->sActualResult.eResultCode = eSelfTest_NotExecuted;
+    }
+    SELFTEST_MEMORY_BARRIER();
+    psSfT_Log->ulSequence = ulSequence + 2u;                          // Even: Log is consistent
 }
 
 
+#if ( EXEC_CYCLIC_RAM == true ) || ( EXEC_CYCLIC_FLASH == true )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Calculates the size of the next tile for SRAM march or flash CRC.
+            Without budget the default size is used. Within a budgeted run the
+            size is calculated from the measured cost of the last tile, so that
+            the tile fits into the remaining budget.
+\return     ulTileSize - Size of the next tile, multiple of ulMinSize
+\param      psTile - Measurement of the last tile
+\param      ulMinSize - Smallest tile size and granularity
+\param      ulMaxSize - Biggest tile size
+\param      ulDefaultSize - Tile size when no budget is given
+**********************************************************************************/
+static u32 AdaptTileSize(const tsSelfTest_Tile* psTile, u32 ulMinSize, u32 ulMaxSize, u32 ulDefaultSize)
+{
+    u32 ulTileSize = ulDefaultSize;
+
+    if(ulSfT_BudgetLeft)
+    {
+        if(psTile->ulCost == 0u)
+        {
+            /* Last tile was too fast to be measured. Grow */
+            ulTileSize = psTile->ulSize << 1u;
+        }
+        else
+        {
+            /* Bytes which fit into the remaining budget. The exact ratio, a truncated
+               time per byte would make the tile up to twice too big */
+            u64 ullTileSize = ((u64)ulSfT_BudgetLeft * psTile->ulSize) / psTile->ulCost;
 
+            ulTileSize = (ullTileSize > ulMaxSize) ? ulMaxSize : (u32)ullTileSize;
+        }
 
-/****************************************** External visible functions **********************************/
+        if(ulTileSize > ulMaxSize)
+        {
+            ulTileSize = ulMaxSize;
+        }
+        ulTileSize -= ulTileSize % ulMinSize;
+
+        if(ulTileSize < ulMinSize)
+        {
+            ulTileSize = ulMinSize;
+        }
+    }
+    return ulTileSize;
+}
+#endif
+
+
+#if ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_CRC_ASYNC == true )
 //********************************************************************************
 /*!
 \author     Kraemer E.
-\date       20.01.2019
-\brief      Handles the self tests on the start up of the system.
-            When everything is fine the main taks is called.
+\date       16.10.2026
+\brief      Notes the start of a background CRC job for the tile adaption.
+            Only a job started within a budget is measured.
 \return     none
-\param      none
-***********************************************************************************/
-void OS_SelfTest_StartCallback(void)
+\param      ulStart - SELFTEST_GET_TIME() at the start of the job
+\param      ulSize - Bytes of the job
+**********************************************************************************/
+static void StartFlashJob(u32 ulStart, u32 ulSize)
 {
+    ulSfT_FlashJobStart = ulStart;
+    ulSfT_FlashJobSize = (ulSfT_BudgetLeft > 0u) ? ulSize : 0u;
+}
 
-    #if SELFTEST_S_ENABLE
-        /***** do CPU Register test before memory initialization *******/
-        #if EXEC_STARTUP_CPUREG
-            if(HAL_SelfTest_CPU_Reg())
-            {
-                 while(1u);               // !!! Stop on error.
-            }
-        #endif
 
-        /***** do CPU program counter test before memory initialization ******/
-        #if EXEC_STARTUP_CPUPC
-            if (HAL_SelfTest_CPU_PC())
-            {
-                while(1u);                // !!! Stop on error.
-            }
-        #endif
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Measures the completed background CRC job for the tile adaption.
+            The job time runs up to the poll which returned the result, so the
+            next job is sized to complete within the slice it was started in.
+            A job completed outside a budget isn't measured.
+\return     none
+\param      ulNow - SELFTEST_GET_TIME() of the poll, unused outside a budget
+**********************************************************************************/
+static void CompleteFlashJob(u32 ulNow)
+{
+    if(ulSfT_FlashJobSize && (ulSfT_BudgetLeft > 0u))
+    {
+        sSfT_FlashTile[SELFTEST_CRC_POLY_CRC32].ulSize = ulSfT_FlashJobSize;
+        sSfT_FlashTile[SELFTEST_CRC_POLY_CRC32].ulCost = ulNow - ulSfT_FlashJobStart;
+    }
+    ulSfT_FlashJobSize = 0u;
+}
+#endif
 
-        /****** do SRAM test before memory initialization *******/
-        #if EXEC_STARTUP_RAM
-            if (HAL_SelfTest_RAM())          // !!! don't return on error.
-            {
-                while(1u);                // !!! Stop on error.
-            }
-        #endif
 
-        /****** do Stack test before memory initialization *******/
-        #if EXEC_STARTUP_STACK
-            /* Initialize self-test stack */
-            HAL_SelfTest_Stack_Init();
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Updates the estimated cost of a test group with the measured time.
+            Rises immediately and decays slowly, so the estimation stays
+            on the safe side for the budget check.
+\return     none
+\param      eTestID - The executed test
+\param      ulCost - Measured time of the executed step
+**********************************************************************************/
+static void UpdateStepCost(teSelfTest_ID eTestID, u32 ulCost)
+{
+    u32 ulEstimation = ulSfT_StepCost[eTestID];
 
-            if (HAL_SelfTest_Stack_Check())         // !!! don't return on error.
-            {
-                while(1u);               // !!! Stop on error.
-            }
-        #endif
-    #endif  // SELFTEST_S_ENABLE
+    if(ulCost >= ulEstimation)
+    {
+        ulEstimation = ulCost;
+    }
+    else
+    {
+        ulEstimation -= (ulEstimation - ulCost) >> 3u;
+    }
+    ulSfT_StepCost[eTestID] = ulEstimation;
+}
 
-    /* Initialize standard memory */
-    HAL_MemoryInit_Init();
-    HAL_SelfTest_Stack_Init();
 
-    #if SELFTEST_S_ENABLE
+#if ( ( EXEC_CYCLIC_RAM == true ) && ( SELFTEST_RAM_MODE != SELFTEST_RAM_MODE_ECC_SCRUB ) ) || ( EXEC_CYCLIC_STACK == true )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Records the measured interrupt lock window of a test
+\return     none
+\param      eTestID - The executed test
+\param      ulLockTime - Measured lock window in SELFTEST_GET_TIME() units
+**********************************************************************************/
+static void RecordLockTime(teSelfTest_ID eTestID, u32 ulLockTime)
+{
+    #if SELFTEST_PROFILING == true
+    tsSelfTest_LockStat* psStat = &sSfT_LockStat[eTestID];
 
-        //***** do Interrupt and time-base test AFTER memory initialization
-        // Using CyDelayUS needs initialized memory !!! //
-        #if EXEC_STARTUP_INTERRUPT
-            if(HAL_SelfTest_TimeBase())
-            {
-                while(1u);                // !!! Stop on error.
-            }
-        #endif
+    if(ulLockTime > psStat->ulMax)
+    {
+        psStat->ulMax = ulLockTime;
+    }
+    if((SELFTEST_MAX_LOCK_TIME > 0u) && (ulLockTime > SELFTEST_MAX_LOCK_TIME))
+    {
+        psStat->ulExceeded++;
+    }
+    #else
+    (void)eTestID;
+    (void)ulLockTime;
+    #endif
+}
+#endif
 
-        //***** do FLASH test AFTER memory initialization
-        // Needs initialized memory !!! //
-        #if EXEC_STARTUP_FLASH
-            if ( HAL_SelfTest_Flash()!= eSelfTest_OK )
-            {
-                while(1u);               // !!! Stop on error.
-            }
-        #endif
 
-        //***** do ADC SAR test AFTER memory initialization ! //
-        #if EXEC_STARTUP_ADC
-            if(HAL_SelfTest_ADC())
-            {
-                while(1u);                // !!! Stop on error.
-            }
-        #endif
+#if ( EXEC_CYCLIC_RAM == true ) && ( SELFTEST_RAM_MODE != SELFTEST_RAM_MODE_ECC_SCRUB )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Limits the SRAM tile to SELFTEST_MAX_LOCK_TIME. The size of the next
+            tile is extrapolated from the lock window of the last tile, so a
+            split tile grows again when the last window was short.
+\return     Size of the next tile, multiple of TEST_BLOCK_SRAM_LOCK_MIN_SIZE
+\param      psTile - Measurement of the last tile
+\param      ulTileSize - Tile size from AdaptTileSize()
+**********************************************************************************/
+static u32 LimitLockTime(const tsSelfTest_Tile* psTile, u32 ulTileSize)
+{
+    if((SELFTEST_MAX_LOCK_TIME > 0u) && (psTile->ulCost > 0u))
+    {
+        /* Aim 1/8 below the limit, so the jitter of the tile time doesn't exceed it */
+        u32 ulLockSize = (u32)(((u64)psTile->ulSize * (SELFTEST_MAX_LOCK_TIME - (SELFTEST_MAX_LOCK_TIME / 8u))) / psTile->ulCost);
 
-        //***** do UART_1 test AFTER memory initialization ! //
-        #if EXEC_STARTUP_UART
-            HAL_SelfTest_UART_Init()
-            if (HAL_SelfTest_UART_Check())
-            {
-                while(1u);                // !!! Stop on error.
-            }
-        #endif
-        
-        //***** do Time base self-test !//
-        #if EXEC_STARTUP_TIMEBASE
-            if(HAL_SelfTest_TimeBase_StartUp())
-            {
-                while(1u);               // !!! Stop on error 
-            }            
-        #endif
+        ulLockSize -= ulLockSize % TEST_BLOCK_SRAM_LOCK_MIN_SIZE;
+        if(ulLockSize < TEST_BLOCK_SRAM_LOCK_MIN_SIZE)
+        {
+            ulLockSize = TEST_BLOCK_SRAM_LOCK_MIN_SIZE;
+        }
+        if(ulLockSize < ulTileSize)
+        {
+            ulTileSize = ulLockSize;
+        }
+    }
+    return ulTileSize;
+}
+#endif
 
-    #endif  // SELFTEST_S_ENABLE
+#if SELFTEST_FAST_BOOT == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checksum of the boot record. Uses no initialized memory, so it can be
+            called before HAL_MemoryInit_Init().
+\return     Checksum over all fields except the checksum itself
+\param      psRecord - The boot record
+***********************************************************************************/
+static u32 BootRecordChecksum(const tsSelfTest_BootRecord* psRecord)
+{
+    const u32* pulWord = &psRecord->ulSignature;
+    u32 ulSum = 0x5A5A5A5Au;
+    u8 ucIdx;
 
-     /* Start with OS-Main-Task */
-    (void)main();
+    for(ucIdx = 0u; ucIdx < (offsetof(tsSelfTest_BootRecord, ulChecksum) / sizeof(u32)); ucIdx++)
+    {
+        ulSum = ((ulSum << 5u) | (ulSum >> 27u)) ^ pulWord[ucIdx];  // Rotate, so swapped words don't cancel out
+    }
+    return ~ulSum;
+}
 
-    while(1);        // If main returns, make sure we don't return.
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks if the startup may use the fast boot. Uses no initialized
+            memory, so it can be called before HAL_MemoryInit_Init().
+\return     true for a qualified warm reset
+\param      ulReason - Reset cause, SELFTEST_RESET_xxx bits
+***********************************************************************************/
+static bool CheckFastBoot(u32 ulReason)
+{
+    const tsSelfTest_BootRecord* psRecord = &sSfT_BootRecord;
+    bool bFastBoot = false;
+
+    if((ulReason != 0u)
+    && ((ulReason & ~(u32)(SELFTEST_WARM_RESET_CAUSES)) == 0u)
+    && (psRecord->ulSignature == SELFTEST_BOOT_SIGNATURE)
+    && (psRecord->ulChecksum == BootRecordChecksum(psRecord))
+    && (psRecord->ulPassCount > 0u)
+    && (psRecord->ulPassedTests == GetSequenceTests())     // Same test configuration
+    && (psRecord->ulWarmBoots < SELFTEST_WARM_BOOT_MAX))
+    {
+        bFastBoot = true;
+    }
+    return bFastBoot;
 }
 
 
 //********************************************************************************
 /*!
 \author     Kraemer E.
-\date       20.01.2019
-\brief      Handles the self tests on the start up of the system.
-            When everything is fine the main taks is called.
+\date       16.10.2026
+\brief      Writes the boot record for this boot. The passes are counted again
+            from 0, so the next fast boot needs a complete pass of this boot.
+            The position of the flash test is kept on a fast boot.
 \return     none
+\param      ulReason - Reset cause of this boot
+\param      bFastBoot - true when this boot is a fast boot
+***********************************************************************************/
+static void WriteBootRecord(u32 ulReason, bool bFastBoot)
+{
+    tsSelfTest_BootRecord* psRecord = &sSfT_BootRecord;
+
+    psRecord->ulWarmBoots = bFastBoot ? (psRecord->ulWarmBoots + 1u) : 0u;
+    psRecord->ulSignature = SELFTEST_BOOT_SIGNATURE;
+    psRecord->ulResetReason = ulReason;
+    psRecord->ulPassCount = 0u;
+    psRecord->ulPassedTests = 0u;
+    psRecord->ulPassTime = 0u;
+    if(bFastBoot == false)
+    {
+        psRecord->ulFlashTile = 0u;        // The flash test resumes only after a fast boot
+    }
+    psRecord->ulChecksum = BootRecordChecksum(psRecord);
+}
+#endif
+
+#if ( SELFTEST_MICRO_STEPS == true ) && ( ( EXEC_CYCLIC_CPUREG == true ) || ( EXEC_CYCLIC_STACK == true ) \
+    || ( ( EXEC_CYCLIC_ADC == true ) && ( SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_DIRECT ) ) \
+    || ( ( EXEC_CYCLIC_UART == true ) && ( SELFTEST_UART_MODE == SELFTEST_UART_MODE_LOOPBACK ) ) )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Runs the next sub-step of a resumable HAL test. The sub-step index
+            is the number of steps of the actual test run, so the test restarts
+            with sub-step 0 after completion.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      pfnMicroStep - The resumable HAL test
+***********************************************************************************/
+static teSelfTest_StepResult RunMicroStep(pfnSelfTest_MicroStep pfnMicroStep)
+{
+    teSelfTest_StepResult eResult = eSelfTest_Step_Error;
+    u8 ucResult = pfnMicroStep(psSfT_State->ulTile - 1u);
+
+    if(ucResult == PASS_STILL_TESTING_STATUS)
+    {
+        eResult = eSelfTest_Step_Pending;
+    }
+    else if(ucResult == PASS_COMPLETE_STATUS)
+    {
+        eResult = eSelfTest_Step_Done;
+    }
+    return eResult;
+}
+#endif
+
+#if EXEC_CYCLIC_CPUREG == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: Test CPU register, one register group per call
+            with SELFTEST_MICRO_STEPS
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
 \param      none
 ***********************************************************************************/
-void OS_SelfTest_Cyclic_Run(void)                       // Run the sequence of cyclic tests
+static teSelfTest_StepResult Step_CpuReg(void)
+{
+    #if SELFTEST_MICRO_STEPS == true
+        return RunMicroStep(HAL_SelfTest_CPU_RegStep);
+    #else
+        return (HAL_SelfTest_CPU_Reg() != eSelfTest_OK) ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+    #endif
+}
+#endif
+
+#if EXEC_CYCLIC_CPUPC == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: Test CPU program counter
+\return     eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_CpuPc(void)
+{
+    psSfT_State->ulTestResult = 0u;
+    return (HAL_SelfTest_CPU_PC() != eSelfTest_OK) ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+}
+#endif
+
+#if EXEC_CYCLIC_TIMEBASE == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: Test time base. The first call initializes the
+            test, the following calls wait for its result.
+            Skipped when the sys-tick timer is disabled.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_TimeBase(void)
 {
-    ulSfT_Time_0 = OS_SW_Timer_GetSystemTickCount();     // Start duration timer
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
 
-    switch(psSfT_State->eTestID)
+    /* Check for disabled sys-tick timer */
+    if (HAL_Timer_GetTimerStatus() == false)
+    {
+        eResult = eSelfTest_Step_Done;
+    }
+    else if(psSfT_State->ucPhase == 0u)
     {
-        case eSelfTest_ID_INIT:
+        /* Start the interrupt test */
+        if(HAL_SelfTest_TimeBase_CyclicInit() != eSelfTest_OK)
         {
-            psSfT_State->ulTestResult = 0u;
-            psSfT_State->eTestID = eSelfTest_ID_CPUREG; // Go to next test, do not log
-            break;
+            eResult = eSelfTest_Step_Error;
         }
+        psSfT_State->ucPhase = 1u;
+    }
+    else
+    {
+        u8 ucTestResult = HAL_SelfTest_TimeBase_CyclicTest();
 
-        case eSelfTest_ID_CPUREG:                       // Test CPU register
+        if(ucTestResult == eSelfTest_ERROR)
         {
-            #if EXEC_CYCLIC_CPUREG == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                if(HAL_SelfTest_CPU_Reg() != eSelfTest_OK)
-                {
-                    psSfT_Log->sActualResult.eResultCode = eSelfTest_ERROR;
-                    while(1u);               // Stop on error
-                }
-                TestLog(eSelfTest_ID_CPUPC, eSelfTest_OK);   // Go to next test, log
-            #endif
-            break;
+            eResult = eSelfTest_Step_Error;
         }
-
-        case eSelfTest_ID_CPUPC:                    // STest CPU program counter
+        else if(ucTestResult == eSelfTest_OK)
         {
-            #if EXEC_CYCLIC_CPUPC == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                psSfT_State->ulTestResult = 0u;
-                if(HAL_SelfTest_CPU_PC() != eSelfTest_OK)
-                {
-                    psSfT_Log->sActualResult.eResultCode = eSelfTest_ERROR;
-                    while(1u);      //Stop on error
-                }
-
-                TestLog(eSelfTest_ID_TIMEBASE, eSelfTest_OK);
-            #endif
-            break;
+            eResult = eSelfTest_Step_Done;
         }
-
-        case eSelfTest_ID_TIMEBASE:                  // STest  timebase
+        else
         {
-            /* If cyclic interrupt test is disabled, jump over to eSelfTest_ID_RAM0 */
-            #if EXEC_CYCLIC_TIMEBASE == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                /* Check for disabled sys-tick timer */
-                if (HAL_Timer_GetTimerStatus() == false)
-                {
-                    psSfT_State->eTestID += SELFTEST_ID_DELTA;
-                }
-                else
-                {
-                    /* Interrupt test is - start with interrupt0_start up */
-                    if(HAL_SelfTest_TimeBase_CyclicInit() != eSelfTest_OK)
-                    {
-                        psSfT_Log->sActualResult.eResultCode = eSelfTest_ERROR;
-                        while(1u);                // Stop on error
-                    }
+            //Test is still pending.
+        }
+    }
+    return eResult;
+}
+#endif
 
-                    /* Next test state is interrupt 1 */
-                    TestLog(eSelfTest_ID_RAM0, eSelfTest_OK);
-                }
-            #endif
-            break;
+#if ( EXEC_CYCLIC_RAM == true ) && ( SELFTEST_RAM_SKIP_STACK == true )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Keeps the next SRAM tile off the stack: A tile within the stack
+            moves behind it, a tile reaching into it ends in front of it.
+\return     true when the rest of the SRAM is stack
+\param      none
+***********************************************************************************/
+static bool SkipRamStack(void)
+{
+    u32 ulTileAdr = psSfT_State->ulTestAddress + psSfT_State->ulTestOffset;
+
+    if(SELFTEST_RAM_SKIP_SIZE > 0u)
+    {
+        if((ulTileAdr >= SELFTEST_RAM_SKIP_START) && (ulTileAdr <= SELFTEST_RAM_SKIP_END))
+        {
+            psSfT_State->ulTestAddress += (SELFTEST_RAM_SKIP_END + 1u) - ulTileAdr;
+            ulTileAdr = SELFTEST_RAM_SKIP_END + 1u;
         }
-        
-        case eSelfTest_ID_TIMEBASE1:                  // STest  timebase
-        {
-            /* If cyclic interrupt test is disabled, jump over to eSelfTest_ID_RAM0 */
-            #if EXEC_CYCLIC_TIMEBASE == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                /* Check for disabled sys-tick timer */
-                if (HAL_Timer_GetTimerStatus() == false)
-                {
-                    psSfT_State->eTestID += SELFTEST_ID_DELTA;
-                }
-                else
-                {
-                    /* Interrupt test is - start with interrupt0_start up */
-                    u8 ucTestResult = HAL_SelfTest_TimeBase_CyclicTest();
-                    
-                    if(ucTestResult == eSelfTest_ERROR)
-                    {
-                        psSfT_Log->sActualResult.eResultCode = eSelfTest_ERROR;
-                        while(1u);                // Stop on error
-                    }
-                    else if(ucTestResult == eSelfTest_OK)
-                    {
-                        /* Next test state is interrupt 1 */
-                        TestLog(eSelfTest_ID_RAM0, eSelfTest_OK);
-                    }
-                    else
-                    {
-                        //Test is still pending. 
-                    }
-                }
-            #endif
-            break;
+        else if((ulTileAdr < SELFTEST_RAM_SKIP_START) && (psSfT_State->ulTestSize > (SELFTEST_RAM_SKIP_START - ulTileAdr)))
+        {
+            psSfT_State->ulTestSize = SELFTEST_RAM_SKIP_START - ulTileAdr;
         }
+    }
+    return (ulTileAdr > TEST_SRAM_ENDADR);
+}
+#endif
+
+#if EXEC_CYCLIC_RAM == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: March test of the SRAM. The first call tests the
+            save buffer ( size of one tile ), each following call tests one tile.
+            The transparent March needs no save buffer, its first call only
+            prepares the test. The tiles are split to SELFTEST_MAX_LOCK_TIME.
+            The ECC scrub only reads, its tiles run without interrupt lock.
+            The transparent March skips the stack, see SELFTEST_RAM_SKIP_SIZE.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Ram(void)
+{
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
 
-        case eSelfTest_ID_RAM0:         // Test the save buffer ( size of one tile )
+    if(psSfT_State->ucPhase == 0u)
+    {
+        #if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_MARCH
+        if(SelfTest_March_Buffer(TEST_BUFFER_STARTADR, TEST_BLOCK_SRAM_SIZE) == ERROR_STATUS)
         {
-            #if EXEC_CYCLIC_RAM == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                if(SelfTest_March_Buffer(TEST_BUFFER_STARTADR, TEST_BLOCK_SRAM_SIZE) == ERROR_STATUS)
-                {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);  // Stop on error ( probably the test stops in situ )
-                }
+            eResult = eSelfTest_Step_Error;  // Stop on error ( probably the test stops in situ )
+        }
+        #endif
 
-                psSfT_State->ulTestAddress = TEST_SRAM_STARTADR;      // Prepare the SRAM test
-                psSfT_State->ulTestSize = TEST_BLOCK_SRAM_SIZE;
-                psSfT_State->ulTestOffset = 0u;            // Start this session with offset 0
-                psSfT_State->eTestID = eSelfTest_ID_RAM1;
-            #endif
-            break;
+        psSfT_State->ulTestAddress = TEST_SRAM_STARTADR;      // Prepare the SRAM test
+        psSfT_State->ulTestSize = TEST_BLOCK_SRAM_SIZE;
+        psSfT_State->ulTestOffset = 0u;            // Start this session with offset 0
+        psSfT_State->ucPhase = 1u;
+    }
+    #if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+    else
+    {
+        bool bMeasure = (ulSfT_BudgetLeft > 0u);               // Only the tile adaption uses the time
+        u32 ulTileStart = SELFTEST_STAMP(bMeasure);
+
+        psSfT_State->ulTestSize = AdaptTileSize(&sSfT_RamTile, SELFTEST_ECC_TILE_MIN_SIZE, SELFTEST_ECC_TILE_SIZE, SELFTEST_ECC_TILE_SIZE);
+        psSfT_State->ulTestResult = OS_SelfTest_ECC_Scrub(psSfT_State->ulTestAddress, psSfT_State->ulTestSize, TEST_SRAM_ENDADR);
+        if(bMeasure)
+        {
+            sSfT_RamTile.ulSize = psSfT_State->ulTestSize;
+            sSfT_RamTile.ulCost = SELFTEST_GET_TIME() - ulTileStart;
         }
 
-        case eSelfTest_ID_RAM1:
+        if(psSfT_State->ulTestResult == PASS_STILL_TESTING_STATUS)
         {
-            #if EXEC_CYCLIC_RAM == true
-                psSfT_State->ulTestResult = SelfTest_March_SRAM((psSfT_State->ulTestAddress + psSfT_State->ulTestOffset), psSfT_State->ulTestSize,TEST_SRAM_ENDADR);
-                psSfT_State->eTestID = eSelfTest_ID_RAM2;
-            #endif
-            break;
+            psSfT_State->ulTestAddress += psSfT_State->ulTestSize;
+        }
+        else if(psSfT_State->ulTestResult == PASS_COMPLETE_STATUS)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+        else    // Uncorrectable ECC error or too many corrected errors
+        {
+            eResult = eSelfTest_Step_Error;
         }
+    }
+    #else
+    else
+    {
+        /* The time is used by the lock statistic, the lock limit and the tile adaption */
+        bool bMeasure = (SELFTEST_PROFILING == true) || (SELFTEST_MAX_LOCK_TIME > 0u) || (ulSfT_BudgetLeft > 0u);
+        u32 ulTileStart;
+        psSfT_State->ulTestSize = AdaptTileSize(&sSfT_RamTile, TEST_BLOCK_SRAM_MIN_SIZE, TEST_BLOCK_SRAM_SIZE, TEST_BLOCK_SRAM_SIZE);
+        psSfT_State->ulTestSize = LimitLockTime(&sSfT_RamTile, psSfT_State->ulTestSize);
+        #if SELFTEST_RAM_SKIP_STACK == true
+        (void)SkipRamStack();                                   // Phase 0 or the last tile may end at the stack
+        #endif
 
-        case eSelfTest_ID_RAM2:
+        /* The lock window is measured around the tile, it includes the lock inside the HAL routine */
+        ulTileStart = SELFTEST_STAMP(bMeasure);
+        #if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_TRANSPARENT
+        SELFTEST_IRQ_LOCK();
+        psSfT_State->ulTestResult = OS_SelfTest_March_Transparent((psSfT_State->ulTestAddress + psSfT_State->ulTestOffset), psSfT_State->ulTestSize,TEST_SRAM_ENDADR);
+        SELFTEST_IRQ_UNLOCK();
+        #else
+        psSfT_State->ulTestResult = SelfTest_March_SRAM((psSfT_State->ulTestAddress + psSfT_State->ulTestOffset), psSfT_State->ulTestSize,TEST_SRAM_ENDADR);
+        #endif
+        if(bMeasure)
         {
-            #if EXEC_CYCLIC_RAM == true
-                if(psSfT_State->ulTestResult == PASS_STILL_TESTING_STATUS)
-                {
-                    psSfT_State->ulTestAddress += psSfT_State->ulTestSize;
-                    psSfT_State->eTestID = eSelfTest_ID_RAM1;
-                }
-                else if(psSfT_State->ulTestResult == PASS_COMPLETE_STATUS)
-                {
-                    TestLog(eSelfTest_ID_STACK0, eSelfTest_OK);
-                }
-                else if(psSfT_State->ulTestResult == ERROR_STATUS)
-                {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);
-                }
-                else    // Program Error
-                {
-                    while(1u);
-                }
-            #endif
-            break;
+            sSfT_RamTile.ulSize = psSfT_State->ulTestSize;
+            sSfT_RamTile.ulCost = SELFTEST_GET_TIME() - ulTileStart;
+            RecordLockTime(eSelfTest_ID_RAM, sSfT_RamTile.ulCost);
         }
 
-        case eSelfTest_ID_STACK:                      // First test the save buffer
+        if(psSfT_State->ulTestResult == PASS_STILL_TESTING_STATUS)
         {
-            #if EXEC_CYCLIC_STACK == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                if(HAL_SelfTest_Stack_Check() == ERROR_STATUS)
-                {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);               // Stop on error
-                }
-                TestLog(eSelfTest_ID_STACKOVF, eSelfTest_OK);
+            psSfT_State->ulTestAddress += psSfT_State->ulTestSize;
+            #if SELFTEST_RAM_SKIP_STACK == true
+            if(SkipRamStack())
+            {
+                eResult = eSelfTest_Step_Done;                  // The stack reaches to TEST_SRAM_ENDADR
+            }
             #endif
-            break;
         }
+        else if(psSfT_State->ulTestResult == PASS_COMPLETE_STATUS)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+        else    // ERROR_STATUS or program error
+        {
+            eResult = eSelfTest_Step_Error;
+        }
+    }
+    #endif
+    return eResult;
+}
+#endif
+
+#if EXEC_CYCLIC_STACK == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: Test the stack. The check runs with locked
+            interrupts, its lock window is monitored. One stack segment per
+            call with SELFTEST_MICRO_STEPS.
+            With SELFTEST_STACK_WATERMARK the passed check is followed by the
+            scan for the high-water mark, outside of the lock.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Stack(void)
+{
+    teSelfTest_StepResult eResult;
+
+    #if SELFTEST_STACK_WATERMARK == true
+    if(psSfT_State->ucPhase == 1u)
+    {
+        u8 ucStatus = OS_SelfTest_Stack_Scan();
+
+        eResult = eSelfTest_Step_Pending;
+        if(ucStatus == ERROR_STATUS)
+        {
+            eResult = eSelfTest_Step_Error;
+        }
+        else if(ucStatus == PASS_COMPLETE_STATUS)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+    }
+    else
+    #endif
+    {
+        #if SELFTEST_PROFILING == true
+            u32 ulLockStart = SELFTEST_GET_TIME();
+        #endif
+        #if SELFTEST_MICRO_STEPS == true
+            eResult = RunMicroStep(HAL_SelfTest_Stack_CheckStep);
+        #else
+            eResult = (HAL_SelfTest_Stack_Check() == ERROR_STATUS) ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+        #endif
 
-        case eSelfTest_ID_STACKOVF:
+        #if SELFTEST_PROFILING == true
+            RecordLockTime(eSelfTest_ID_STACK, SELFTEST_GET_TIME() - ulLockStart);
+        #endif
+
+        #if SELFTEST_STACK_WATERMARK == true
+        if(eResult == eSelfTest_Step_Done)
         {
-            #if EXEC_CYCLIC_STACKOVF == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                if(!(SelfTest_StackOverflow()))       // Stack limit test
-                {
-                    TestLog(eSelfTest_ID_FLASH0, eSelfTest_OK);
-                }
-                else
-                {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);    // Stop on error
-                }
-            #endif
-            break;
+            psSfT_State->ucPhase = 1u;              // Continue with the scan
+            eResult = eSelfTest_Step_Pending;
         }
+        #endif
+    }
+    return eResult;
+}
+#endif
+
+#if EXEC_CYCLIC_STACKOVF == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: Stack limit test
+\return     eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_StackOvf(void)
+{
+    return SelfTest_StackOverflow() ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+}
+#endif
+
+#if ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_IMAGE )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts the CRC job of the next tile of the image. Without budget
+            a background engine gets the biggest tile, it doesn't load the CPU.
+            Within a budget the tile is adapted, a background job from its
+            time up to the result.
+\return     PASS_STILL_TESTING_STATUS when started, ERROR_STATUS otherwise
+\param      none
+***********************************************************************************/
+static u8 StartFlashTile(void)
+{
+    tsSelfTest_Tile* psTile = &sSfT_FlashTile[SELFTEST_CRC_POLY_CRC32];
+    u32 ulTileStart = SELFTEST_STAMP(ulSfT_BudgetLeft > 0u);   // Only the tile adaption uses the time
+    u32 ulTileSize = AdaptTileSize(psTile, ST_FLASH_TILE_SIZE, ST_FLASH_TILE_MAX_SIZE, ST_FLASH_TILE_JOB_SIZE);
+    u8 ucStatus = ERROR_STATUS;
+
+    if(psSfT_State->slTestCount > (s32)ulTileSize)  // Not null
+    {
+        psSfT_State->ulTestSize = ulTileSize; // Number of bytes is bigger than a tile size
+    }
+    else
+    {
+        psSfT_State->ulTestSize = psSfT_State->slTestCount; // Number of bytes is already equal or smaller than a tile size
+    }
+
+    if(OS_SelfTest_CRC_Start(SELFTEST_FLASH_PTR(psSfT_State->ulTestAddress), psSfT_State->ulTestSize, psSfT_State->ulTestResult) == OK_STATUS)
+    {
+        ucStatus = PASS_STILL_TESTING_STATUS;
+    }
 
-        case eSelfTest_ID_FLASH0:         // Test Segments 1 - 4, 0 is not used here
+    #if SELFTEST_CRC_ASYNC == true
+        StartFlashJob(ulTileStart, psSfT_State->ulTestSize);
+    #else
+        if(ulSfT_BudgetLeft > 0u)
         {
-            #if EXEC_CYCLIC_FLASH == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                psSfT_State->ulTestOffset = ST_FLASH_SEGIDX_S1;      // Used as segment number
-                psSfT_State->slTestCount = uAppCodeLength;       // Used as overall byte count
+            psTile->ulSize = psSfT_State->ulTestSize;
+            psTile->ulCost = SELFTEST_GET_TIME() - ulTileStart;
+        }
+    #endif
 
-                if(0 == psSfT_State->slTestCount)
-                {
-                    psSfT_State->eTestID += SELFTEST_ID_DELTA;             // Go to next test
-                }
-                else
-                {
-                    psSfT_State->ulTestAddress = uAppCodeStart;       // Start with segment 1
-                    psSfT_State->ulTestResult = CRC_INIT_VALUE;
-                    psSfT_State->eTestID = eSelfTest_ID_FLASH1;          // Execute CRC check
-                }
-            #endif
-            break;
+    return ucStatus;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: CRC of the application image. The first call
+            prepares the test, each following call adds one tile to the CRC.
+            With SELFTEST_CRC_ASYNC the tile runs in the background and the
+            following calls only poll for its completion, the completion
+            starts the next tile at once.
+            The last tile compares the CRC with the post-link reference.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Flash(void)
+{
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
+
+    if(psSfT_State->ucPhase == 0u)
+    {
+        psSfT_State->ulTestOffset = ST_FLASH_SEGIDX_S1;      // Used as segment number
+        psSfT_State->slTestCount = ulAppCodeLength;       // Used as overall byte count
+
+        if(0 == psSfT_State->slTestCount)
+        {
+            eResult = eSelfTest_Step_Done;             // Go to next test
+        }
+        else
+        {
+            psSfT_State->ulTestAddress = ulAppCodeStart;       // Start with segment 1
+            psSfT_State->ulTestResult = CRC_INIT_VALUE;
+            psSfT_State->ucPhase = 1u;                          // Execute CRC check
+        }
+    }
+    else
+    {
+        u8 ucStatus = PASS_STILL_TESTING_STATUS;
+        u32 ulCrc = 0u;
+
+        if(psSfT_State->ucPhase == 1u)
+        {
+            ucStatus = StartFlashTile();
+            psSfT_State->ucPhase = 2u;                          // Wait for the tile
         }
 
-        case eSelfTest_ID_FLASH1:
+        if(ucStatus == PASS_STILL_TESTING_STATUS)
         {
-            #if EXEC_CYCLIC_FLASH == true
-                if(psSfT_State->slTestCount > (s32)ST_FLASH_TILE_SIZE)  // Not null
+            ucStatus = OS_SelfTest_CRC_Poll(&ulCrc);
+        }
+
+        if(ucStatus == PASS_COMPLETE_STATUS)
+        {
+            #if SELFTEST_CRC_ASYNC == true
+                CompleteFlashJob(SELFTEST_STAMP(ulSfT_BudgetLeft > 0u));
+            #endif
+            psSfT_State->ulTestResult = ulCrc;
+            psSfT_State->slTestCount = psSfT_State->slTestCount - psSfT_State->ulTestSize;
+
+            if(psSfT_State->slTestCount < 1)             // If it has reached 0 now, check CRC
+            {
+                if(SelfTest_FlashCRCRead(psSfT_State->ulTestOffset) != ~psSfT_State->ulTestResult) // Compare with last inversion
                 {
-                    psSfT_State->ulTestSize = ST_FLASH_TILE_SIZE; // Number of bytes is bigger than a tile size
+                    eResult = eSelfTest_Step_Error;         // Stop on CRC error
                 }
                 else
                 {
-                    psSfT_State->ulTestSize = psSfT_State->slTestCount; // Number of bytes is already equal or smaller than a tile size
+                    eResult = eSelfTest_Step_Done;
                 }
-                psSfT_State->ulTestResult = eSelfTest_C_FlashCRC((u8*)psSfT_State->ulTestAddress, psSfT_State->ulTestSize, psSfT_State->ulTestResult);
-                psSfT_State->slTestCount = psSfT_State->slTestCount - ST_FLASH_TILE_SIZE;
+            }
+            else
+            {
+                psSfT_State->ulTestAddress += psSfT_State->ulTestSize;  // Next row in same segment
+                psSfT_State->ucPhase = 1u;
 
-                if(psSfT_State->slTestCount < 1)             // If it has reached 0 now, check CRC
-                {
-                    if(SelfTest_FlashCRCRead(psSfT_State->ulTestOffset) != ~psSfT_State->ulTestResult) // Compare with last inversion
+                #if SELFTEST_CRC_ASYNC == true
+                    /* Keep the engine busy, the next call only polls */
+                    if(StartFlashTile() != PASS_STILL_TESTING_STATUS)
                     {
-                        psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                        while(1u);           // Stop on CRC error
+                        eResult = eSelfTest_Step_Error;
                     }
-                    TestLog(eSelfTest_ID_IO0, eSelfTest_OK);
-                }
-                else
-                {
-                    psSfT_State->ulTestAddress += ST_FLASH_TILE_SIZE;  // Next row in same segment
-                }
-            #endif
-            break;
+                    psSfT_State->ucPhase = 2u;
+                #endif
+            }
+        }
+        else if(ucStatus != PASS_STILL_TESTING_STATUS)
+        {
+            eResult = eSelfTest_Step_Error;             // Engine fault
+        }
+        else
+        {
+            // Tile still running in the background
         }
+    }
+    return eResult;
+}
+#elif ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_MANIFEST )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Sequence step: CRC of the application image, tile by tile against
+            the manifest. The first call validates the manifest, each following
+            call checks one tile or, in the budgeted run, several tiles.
+            With SELFTEST_CRC_ASYNC a tile runs in the background and the
+            following calls only poll for its completion.
+            A pass checks each tile once, starting at the tile where the last
+            pass stopped. With SELFTEST_FAST_BOOT the position survives a warm reset.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Flash(void)
+{
+    const tsSelfTest_FlashManifest* psManifest = psSfT_FlashManifest;
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
+
+    if(psSfT_State->ucPhase == 0u)
+    {
+        psManifest = OS_SelfTest_Flash_GetManifest();
+        psSfT_FlashManifest = psManifest;
 
-        case eSelfTest_ID_IO0:
+        if(psManifest == NULL)
+        {
+            eResult = eSelfTest_Step_Error;             // Manifest missing or corrupted
+        }
+        else if(psManifest->ulTileCount == 0u)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+        else
         {
-            #if EXEC_CYCLIC_IO == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                psSfT_State->ulTestOffset = 0u;                // Use TestOffset as PortNumber
-                psSfT_State->eTestID = eSelfTest_ID_IO1;
+            #if SELFTEST_FAST_BOOT == true
+                psSfT_State->ulTestOffset = sSfT_BootRecord.ulFlashTile;  // Used as tile index
             #endif
-            break;
+            if(psSfT_State->ulTestOffset >= psManifest->ulTileCount)
+            {
+                psSfT_State->ulTestOffset = 0u;
+            }
+            psSfT_State->slTestCount = psManifest->ulTileCount;  // Used as tile count of this pass
+            psSfT_State->ucPhase = 1u;
         }
+    }
+    else
+    {
+        u32 ulTileStart = SELFTEST_STAMP(ulSfT_BudgetLeft > 0u);   // Only the tile adaption uses the time
+        u32 ulTileSize = psManifest->ulTileSize;
+        u32 ulTiles = AdaptTileSize(&sSfT_FlashTile[SELFTEST_CRC_POLY_CRC32], ulTileSize, ulTileSize * (ST_FLASH_TILE_MAX_SIZE / ST_FLASH_TILE_SIZE), ulTileSize) / ulTileSize;
+        u32 ulChecked = 0u;
+        u8 ucStatus = PASS_STILL_TESTING_STATUS;
 
-        case eSelfTest_ID_IO1:
+        if(psSfT_State->ucPhase == 1u)
         {
-            #if EXEC_CYCLIC_IO == true
-                if(eSelfTest_C_IO(psSfT_State->ulTestOffset) != eSelfTest_OK) // TestOffset holds the port number
-                {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);           // Stop on error
-                }
-                psSfT_State->ulTestOffset++;                              // Increment PortNumber
-
-                if(psSfT_State->ulTestOffset >= IO_PORTS)             // Max port index reached ?
-                {
-                    TestLog(eSelfTest_ID_UREG0, eSelfTest_OK);
-                }
+            ucStatus = OS_SelfTest_Flash_StartTile(psManifest, psSfT_State->ulTestOffset);
+            psSfT_State->ucPhase = 2u;                          // Wait for the tile
+            #if SELFTEST_CRC_ASYNC == true
+                StartFlashJob(ulTileStart, ulTileSize);
             #endif
-            break;
         }
 
-        case eSelfTest_ID_ADC0:                                 // ADC test
+        while(ucStatus == PASS_STILL_TESTING_STATUS)
         {
-            /* If ADC-Test is disabled skip this test an test UART0 */
-            #if EXEC_CYCLIC_ADC == false
-                psSfT_State->eTestID += SELFTEST_ID_DELTA;
-            #else
-                // If ADC is in use, this adds extra ADC conversion cycles, which may influence regular conversion results !
-                if(eSelfTest_S_ADC())
+            ucStatus = OS_SelfTest_Flash_PollTile(psManifest, psSfT_State->ulTestOffset);
+
+            if(ucStatus == OK_STATUS)
+            {
+                #if SELFTEST_CRC_ASYNC == true
+                    CompleteFlashJob(SELFTEST_STAMP(ulSfT_BudgetLeft > 0u));
+                #endif
+                psSfT_State->ulTestOffset++;
+                if(psSfT_State->ulTestOffset >= psManifest->ulTileCount)
                 {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);  // Stop on error
+                    psSfT_State->ulTestOffset = 0u;
                 }
-                TestLog(eSelfTest_ID_UART0, eSelfTest_OK);
-            }
-            #endif
-            break;
-        }
+                psSfT_State->slTestCount--;
+                ulChecked++;
 
-        case eSelfTest_ID_UART0:                                // UART test
-        {
-            #if EXEC_CYCLIC_UART == false
-               psSfT_State->eTestID += SELFTEST_ID_DELTA;
-           #else
-                // Do NOT use UART test!
-                // Communication on Wolf Bus is life test, do not disturb with extra characters !
-                if(HAL_SelfTest_UART_Check())
+                if(psSfT_State->slTestCount <= 0)
+                {
+                    eResult = eSelfTest_Step_Done;
+                }
+                else if((ulChecked < ulTiles) || ((SELFTEST_CRC_ASYNC == true) && (ulSfT_BudgetLeft == 0u)))
                 {
-                    psSfT_Log->sActualResult.eResultCode  = eSelfTest_ERROR;
-                    while(1u);// Stop on error
+                    /* Without budget a background engine gets the next tile at once, the next call only polls */
+                    ucStatus = OS_SelfTest_Flash_StartTile(psManifest, psSfT_State->ulTestOffset);
+                    #if SELFTEST_CRC_ASYNC == true
+                        StartFlashJob(SELFTEST_STAMP(ulSfT_BudgetLeft > 0u), ulTileSize);
+                    #endif
+                    if(ulChecked >= ulTiles)
+                    {
+                        break;
+                    }
                 }
                 else
                 {
-                    TestLog(eSelfTest_ID_EXIT, eSelfTest_OK);
+                    psSfT_State->ucPhase = 1u;                  // Next tile on the next call
                 }
-            #endif
-            break;
+            }
+            else if(ucStatus == PASS_STILL_TESTING_STATUS)
+            {
+                break;                                          // Tile still running in the background
+            }
+            else
+            {
+                // CRC error of this tile or engine fault
+            }
         }
 
-        case eSelfTest_ID_EXIT: // Not a real test. Terminates the sequence of real tests.
+        if(ucStatus == ERROR_STATUS)
         {
-             // If enabled creates testpattern to locate end of test sequence
-            psSfT_State->eTestID = eSelfTest_ID_INIT;
-            TestLog(eSelfTest_ID_INIT, eSelfTest_NotExecuted);
-            ulSfT_Time_1 = OS_SW_Timer_GetSystemTickCount() - ulSfT_Time_0; // Time in msec for the duration of all cyclic self tests
-            break;
+            eResult = eSelfTest_Step_Error;
+        }
+
+        #if SELFTEST_FAST_BOOT == true
+            sSfT_BootRecord.ulFlashTile = psSfT_State->ulTestOffset;
+            sSfT_BootRecord.ulChecksum = BootRecordChecksum(&sSfT_BootRecord);
+        #endif
+
+        #if SELFTEST_CRC_ASYNC != true
+        if(ulChecked && (ulSfT_BudgetLeft > 0u))        // Only polled or no budget: No measurement for the adaption
+        {
+            sSfT_FlashTile[SELFTEST_CRC_POLY_CRC32].ulSize = ulChecked * ulTileSize;
+            sSfT_FlashTile[SELFTEST_CRC_POLY_CRC32].ulCost = SELFTEST_GET_TIME() - ulTileStart;
+        }
+        #endif
+    }
+    return eResult;
+}
+#elif ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Sequence step: CRC of the flash regions of SELFTEST_FLASH_REGIONS.
+            The first call selects the regions due in this pass, each following
+            call checks one tile of the next of these regions in turn.
+            With SELFTEST_CRC_ASYNC a CRC-32 tile runs in the background and the
+            following calls only poll for its completion.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Flash(void)
+{
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
+
+    if(psSfT_State->ucPhase == 0u)
+    {
+        if(OS_SelfTest_Flash_StartRegions() == 0u)
+        {
+            eResult = eSelfTest_Step_Done;              // No region due in this pass
+        }
+        else
+        {
+            psSfT_State->ucPhase = 1u;
         }
+    }
+    else
+    {
+        u32 ulTileStart = SELFTEST_STAMP(ulSfT_BudgetLeft > 0u);   // Only the tile adaption uses the time
+        u8 ucPolynomial = OS_SelfTest_Flash_GetNextPolynomial();
+        tsSelfTest_Tile* psTile = &sSfT_FlashTile[ucPolynomial];
+        bool bJob = (SELFTEST_CRC_ASYNC == true) && (ucPolynomial == SELFTEST_CRC_POLY_CRC32);
+        u32 ulTileSize = AdaptTileSize(psTile, ST_FLASH_TILE_SIZE, ST_FLASH_TILE_MAX_SIZE, bJob ? ST_FLASH_TILE_JOB_SIZE : ST_FLASH_TILE_SIZE);
+        u32 ulBytes = 0u;
+        u8 ucStatus = OS_SelfTest_Flash_StreamRegions(ulTileSize, &ulBytes);
+
+        #if SELFTEST_CRC_ASYNC == true
+            if((ulBytes != 0u) || (ucStatus != PASS_STILL_TESTING_STATUS))
+            {
+                CompleteFlashJob(ulTileStart);          // A running job was completed by the poll of this call
+            }
+            if(bJob && ulBytes)
+            {
+                StartFlashJob(ulTileStart, ulBytes);
+            }
+        #endif
 
-        default:                                            // Should not happen
+        if(ucStatus == PASS_COMPLETE_STATUS)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+        else if(ucStatus == ERROR_STATUS)
+        {
+            eResult = eSelfTest_Step_Error;
+        }
+        else
         {
-            psSfT_State->eTestID = eSelfTest_ID_INIT;
+            // Next tile on the next call
         }
 
-    } // end switch (  psSfT_State->eTestID )
+        if(ulBytes && !bJob && (ulSfT_BudgetLeft > 0u))  // Only polled, background job or no budget: No measurement here
+        {
+            psTile->ulSize = ulBytes;
+            psTile->ulCost = SELFTEST_GET_TIME() - ulTileStart;
+        }
+    }
+    return eResult;
 }
+#endif
+
+#if ( EXEC_CYCLIC_IO == true ) && ( SELFTEST_IO_MODE == SELFTEST_IO_MODE_BATCH )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Sequence step: Tests SELFTEST_IO_BATCH_PORTS IO ports per call.
+            The pins of aulSfT_IoSkipMask are not tested, failed pins are
+            set in aulSfT_IoFailMask.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Io(void)
+{
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
+    u32 aulTestMask[SELFTEST_IO_BATCH_PORTS];
+    u32 ulPorts = SELFTEST_IO_BATCH_PORTS;
+    u32 ulPort;
 
+    if(psSfT_State->ucPhase == 0u)
+    {
+        psSfT_State->ulTestOffset = 0u;                // Use TestOffset as first port of the batch
+        psSfT_State->ucPhase = 1u;
+    }
+
+    if((psSfT_State->ulTestOffset + ulPorts) > IO_PORTS)
+    {
+        ulPorts = IO_PORTS - psSfT_State->ulTestOffset;
+    }
+    for(ulPort = 0u; ulPort < ulPorts; ulPort++)
+    {
+        aulTestMask[ulPort] = SELFTEST_IO_PIN_MASK & ~aulSfT_IoSkipMask[psSfT_State->ulTestOffset + ulPort];
+    }
 
+    if(HAL_SelfTest_IO_CheckPorts(psSfT_State->ulTestOffset, ulPorts, aulTestMask, &aulSfT_IoFailMask[psSfT_State->ulTestOffset]) != eSelfTest_OK)
+    {
+        eResult = eSelfTest_Step_Error;
+    }
+    else
+    {
+        psSfT_State->ulTestOffset += ulPorts;
 
+        if(psSfT_State->ulTestOffset >= IO_PORTS)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+    }
+    return eResult;
+}
+#elif EXEC_CYCLIC_IO == true
 //********************************************************************************
 /*!
 \author     Kraemer E.
-\date       19.04.2020
-\brief      Initializes the structure for the cyclical callback
-\return     none
+\date       20.01.2019
+\brief      Sequence step: Tests one IO port per call
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
 \param      none
 ***********************************************************************************/
-void OS_SelfTest_InitCyclic(void)                         // Prepare the sequence of cyclic tests
+static teSelfTest_StepResult Step_Io(void)
 {
-    psSfT_State = &sSfT_State;
-    psSfT_State->eTestID = eSelfTest_ID_INIT;
-    psSfT_Log  = &sSfT_Log;
-    psSfT_Log->sLastResult.eResultCode = 0u;
+    teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
+
+    if(psSfT_State->ucPhase == 0u)
+    {
+        psSfT_State->ulTestOffset = 0u;                // Use TestOffset as PortNumber
+        psSfT_State->ucPhase = 1u;
+    }
+
+    if(eSelfTest_C_IO(psSfT_State->ulTestOffset) != eSelfTest_OK) // TestOffset holds the port number
+    {
+        eResult = eSelfTest_Step_Error;
+    }
+    else
+    {
+        psSfT_State->ulTestOffset++;                              // Increment PortNumber
+
+        if(psSfT_State->ulTestOffset >= IO_PORTS)             // Max port index reached ?
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+    }
+    return eResult;
+}
+#endif
+
+#if EXEC_CYCLIC_ADC == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: ADC test
+            If ADC is in use, this adds extra ADC conversion cycles, which may
+            influence regular conversion results !
+            One channel per call with SELFTEST_MICRO_STEPS.
+            SELFTEST_ADC_MODE_SLOT converts the references in free slots of the
+            application without own conversions, see OS_SelfTest_ADC.h.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Adc(void)
+{
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+        teSelfTest_StepResult eResult = eSelfTest_Step_Pending;
+        u8 ucResult;
+
+        if(psSfT_State->ucPhase == 0u)
+        {
+            OS_SelfTest_ADC_Start();
+            psSfT_State->ucPhase = 1u;
+        }
+
+        ucResult = OS_SelfTest_ADC_Poll();
+        if(ucResult == PASS_COMPLETE_STATUS)
+        {
+            eResult = eSelfTest_Step_Done;
+        }
+        else if(ucResult != PASS_STILL_TESTING_STATUS)
+        {
+            eResult = eSelfTest_Step_Error;
+        }
+        return eResult;
+    #elif SELFTEST_MICRO_STEPS == true
+        return RunMicroStep(HAL_SelfTest_ADC_Step);
+    #else
+        return eSelfTest_S_ADC() ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+    #endif
+}
+#endif
+
+#if EXEC_CYCLIC_UART == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: UART test
+            Do NOT use UART test! Communication on Wolf Bus is life test,
+            do not disturb with extra characters !
+            One phase per call with SELFTEST_MICRO_STEPS.
+            SELFTEST_UART_MODE_PASSIVE judges the live traffic instead and sends
+            nothing, see OS_SelfTest_UART.h.
+\return     eSelfTest_Step_Pending, eSelfTest_Step_Done or eSelfTest_Step_Error
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Uart(void)
+{
+    #if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+        return (OS_SelfTest_UART_Check() == ERROR_STATUS) ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+    #elif SELFTEST_MICRO_STEPS == true
+        return RunMicroStep(HAL_SelfTest_UART_CheckStep);
+    #else
+        return HAL_SelfTest_UART_Check() ? eSelfTest_Step_Error : eSelfTest_Step_Done;
+    #endif
+}
+#endif
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Sequence step: Not a real test. Terminates the pass when every
+            test has finished once and starts the next pass.
+\return     eSelfTest_Step_Done
+\param      none
+***********************************************************************************/
+static teSelfTest_StepResult Step_Exit(void)
+{
+    ulSfT_Time_1 = OS_SW_Timer_GetSystemTickCount() - ulSfT_Time_0; // Time in msec for the duration of all cyclic self tests
+    RecordSequence();
+
+    #if SELFTEST_FAST_BOOT == true
+        sSfT_BootRecord.ulPassCount++;
+        sSfT_BootRecord.ulPassedTests = GetSequenceTests();
+        sSfT_BootRecord.ulPassTime = ulSfT_Time_1;
+        sSfT_BootRecord.ulChecksum = BootRecordChecksum(&sSfT_BootRecord);
+    #endif
+
+    ulSfT_Time_0 = OS_SW_Timer_GetSystemTickCount();     // Start duration timer of the next pass
+    ulSfT_PassMask = 0u;
+    return eSelfTest_Step_Done;
+}
+
+
+// Sequence of the cyclic tests. Generated at compile time from the EXEC_CYCLIC_* switches,
+// disabled tests don't get an entry. The scheduler selects the released test with the
+// shortest period, equal periods run in the order of release. The exit step terminates
+// the pass after each test has finished once.
+static const tsSelfTest_StepDesc sSfT_Sequence[] =
+{
+    #if EXEC_CYCLIC_CPUREG == true
+    { eSelfTest_ID_CPUREG,   Step_CpuReg,     SELFTEST_PERIOD_CPUREG,    SELFTEST_DEADLINE_CPUREG   },
+    #endif
+    #if EXEC_CYCLIC_CPUPC == true
+    { eSelfTest_ID_CPUPC,    Step_CpuPc,      SELFTEST_PERIOD_CPUPC,     SELFTEST_DEADLINE_CPUPC    },
+    #endif
+    #if EXEC_CYCLIC_TIMEBASE == true
+    { eSelfTest_ID_TIMEBASE, Step_TimeBase,   SELFTEST_PERIOD_TIMEBASE,  SELFTEST_DEADLINE_TIMEBASE },
+    #endif
+    #if EXEC_CYCLIC_RAM == true
+    { eSelfTest_ID_RAM,      Step_Ram,        SELFTEST_PERIOD_RAM,       SELFTEST_DEADLINE_RAM      },
+    #endif
+    #if EXEC_CYCLIC_STACK == true
+    { eSelfTest_ID_STACK,    Step_Stack,      SELFTEST_PERIOD_STACK,     SELFTEST_DEADLINE_STACK    },
+    #endif
+    #if EXEC_CYCLIC_STACKOVF == true
+    { eSelfTest_ID_STACKOVF, Step_StackOvf,   SELFTEST_PERIOD_STACKOVF,  SELFTEST_DEADLINE_STACKOVF },
+    #endif
+    #if EXEC_CYCLIC_FLASH == true
+    { eSelfTest_ID_FLASH,    Step_Flash,      SELFTEST_PERIOD_FLASH,     SELFTEST_DEADLINE_FLASH    },
+    #endif
+    #if EXEC_CYCLIC_IO == true
+    { eSelfTest_ID_IO,       Step_Io,         SELFTEST_PERIOD_IO,        SELFTEST_DEADLINE_IO       },
+    #endif
+    #if EXEC_CYCLIC_ADC == true
+    { eSelfTest_ID_ADC,      Step_Adc,        SELFTEST_PERIOD_ADC,       SELFTEST_DEADLINE_ADC      },
+    #endif
+    #if EXEC_CYCLIC_UART == true
+    { eSelfTest_ID_UART,     Step_Uart,       SELFTEST_PERIOD_UART,      SELFTEST_DEADLINE_UART     },
+    #endif
+    { eSelfTest_ID_EXIT,     Step_Exit,       0u,                        0u                         }
+};
+
+// Each enabled test must have exactly one entry, otherwise a transition would be lost
+SELFTEST_STATIC_ASSERT(SELFTEST_ARRAY_SIZE(sSfT_Sequence) == SELFTEST_STEP_COUNT, sequence_table_incomplete);
+SELFTEST_STATIC_ASSERT(SELFTEST_STEP_COUNT <= 32u, pass_mask_overflow);
+
+#if ( SELFTEST_FAULT_REACTION_TIME > 0 )
+    #if !defined(SELFTEST_FRT_SRAM_SIZE) || !defined(SELFTEST_FRT_FLASH_SIZE)
+        #error "SELFTEST_FAULT_REACTION_TIME needs SELFTEST_FRT_SRAM_SIZE and SELFTEST_FRT_FLASH_SIZE"
+    #else
+        // The calls released within the fault reaction time must fit into it, then a pass
+        // with the smallest tile sizes ends within it. Increase the minimum tile sizes,
+        // the periods or the call rate when this fails.
+        SELFTEST_STATIC_ASSERT((u64)SELFTEST_CALLS_PASS(SELFTEST_FRT_SRAM_SIZE, SELFTEST_FRT_FLASH_SIZE, SELFTEST_FRT_STACK_SIZE, SELFTEST_FAULT_REACTION_TIME)
+                               * SELFTEST_CALL_PERIOD <= SELFTEST_FAULT_REACTION_TIME, fault_reaction_time_exceeded);
+    #endif
+#endif
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Selects the step to execute (rate monotonic).
+            Of all released tests the one with the shortest period is selected,
+            on equal periods the one released first. Tests without period have
+            the lowest priority and run once per pass. A test stays released until
+            it has finished, so an interrupted test is resumed when no test with
+            a higher priority is pending. The exit step is selected as soon as
+            every test has finished once in this pass.
+\return     Index into sSfT_Sequence, SELFTEST_STEP_COUNT when nothing is released
+\param      ulNow - Actual system tick
+***********************************************************************************/
+static u8 SelectStep(u32 ulNow)
+{
+    // Tests without period run in the background with the lowest priority
+    #define RANK_PERIOD(Idx)    (sSfT_Sequence[Idx].ulPeriod ? sSfT_Sequence[Idx].ulPeriod : 0xFFFFFFFFu)
+
+    u8 ucSelected = SELFTEST_STEP_COUNT;
+    u8 ucIdx;
+
+    if(ulSfT_PassMask == SELFTEST_PASS_MASK)
+    {
+        ucSelected = SELFTEST_EXIT_IDX;
+    }
+    else
+    {
+        for(ucIdx = 0u; (ucIdx + 1u) < SELFTEST_STEP_COUNT; ucIdx++)
+        {
+            const tsSelfTest_State* psState = &sSfT_State[ucIdx];
+
+            /* Without the pass mask a finished test without period would be released
+               again at once and, on the same tick, win against the tests still open */
+            if(((s32)(ulNow - psState->ulRelease) >= 0)
+            && ((sSfT_Sequence[ucIdx].ulPeriod != 0u) || ((ulSfT_PassMask & (1uL << ucIdx)) == 0u)))
+            {
+                if(ucSelected == SELFTEST_STEP_COUNT)
+                {
+                    ucSelected = ucIdx;
+                }
+                else if(RANK_PERIOD(ucIdx) < RANK_PERIOD(ucSelected))
+                {
+                    ucSelected = ucIdx;
+                }
+                else if((RANK_PERIOD(ucIdx) == RANK_PERIOD(ucSelected))
+                     && ((s32)(psState->ulRelease - sSfT_State[ucSelected].ulRelease) < 0))
+                {
+                    ucSelected = ucIdx;
+                }
+                else
+                {
+                    // Lower priority or released later
+                }
+            }
+        }
+    }
+    return ucSelected;
+    #undef RANK_PERIOD
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Handles the completion of a test: Deadline monitoring and next release.
+            A test which is behind its period is released again immediately
+            instead of catching up the missed releases.
+\return     none
+\param      ucStepIdx - Index of the finished step
+\param      ulNow - Actual system tick
+***********************************************************************************/
+static void CompleteStep(u8 ucStepIdx, u32 ulNow)
+{
+    const tsSelfTest_StepDesc* psStep = &sSfT_Sequence[ucStepIdx];
+    tsSelfTest_State* psState = &sSfT_State[ucStepIdx];
+
+    if(psStep->ulDeadline && ((ulNow - psState->ulRelease) > psStep->ulDeadline))
+    {
+        psState->ulDeadlineMisses++;
+    }
+
+    psState->ulRelease += psStep->ulPeriod;
+    if((psStep->ulPeriod == 0u) || ((s32)(ulNow - psState->ulRelease) > 0))
+    {
+        psState->ulRelease = ulNow;
+    }
+
+    ulSfT_PassTime[psStep->eTestID] = ulNow - psState->ulStart;
+    ulSfT_PassSteps[psStep->eTestID] = psState->ulTile;
+    if((psStep->eTestID == eSelfTest_ID_TIMEBASE) && (ulNow != psState->ulStart)
+    && (((u64)psState->ulTile * ulSfT_RateTicks) >= ((u64)ulSfT_RateCalls * (ulNow - psState->ulStart))))
+    {
+        /* The time base test waits with one call after the other, its calls per tick are the call rate */
+        ulSfT_RateCalls = psState->ulTile;
+        ulSfT_RateTicks = ulNow - psState->ulStart;
+    }
+    #if SELFTEST_PROFILING == true
+        ulSfT_PassWork[psStep->eTestID] = psState->ulRunTime;
+    #else
+        ulSfT_PassWork[psStep->eTestID] = psState->ulTile;
+    #endif
+
+    psState->ucPhase = 0u;
+    psState->ulTile = 0u;
+    psState->ulRunTime = 0u;
+    if(ucStepIdx != SELFTEST_EXIT_IDX)
+    {
+        ulSfT_PassMask |= (1uL << ucStepIdx);
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Executes one step of the cyclic self test sequence with the state
+            of the step. A finished test is logged into the history and
+            released for its next period. Stops on error, the failed test is
+            logged into the history before.
+\return     none
+\param      ucStepIdx - Index into sSfT_Sequence
+\param      ulStepStart - SELFTEST_GET_TIME() at the start of the step
+***********************************************************************************/
+static void RunTestStep(u8 ucStepIdx, u32 ulStepStart)
+{
+    const tsSelfTest_StepDesc* psStep = &sSfT_Sequence[ucStepIdx];
+    teSelfTest_StepResult eResult;
+
+    psSfT_State = &sSfT_State[ucStepIdx];
+    psSfT_State->eTestID = psStep->eTestID;
+    psSfT_State->ulTile++;
+    if(psSfT_State->ulTile == 1u)
+    {
+        psSfT_State->ulStart = OS_SW_Timer_GetSystemTickCount();
+    }
+    eResult = psStep->pfnStep();
+    #if SELFTEST_PROFILING == true
+        psSfT_State->ulRunTime += SELFTEST_GET_TIME() - ulStepStart;
+    #else
+        (void)ulStepStart;                          // History without durations
+    #endif
+
+    if(eResult == eSelfTest_Step_Done)
+    {
+        OS_SelfTest_History_Write(psSfT_State->eTestID, eSelfTest_OK, psSfT_State->ulRunTime, psSfT_State->ulTile);
+        TestLog(eSelfTest_OK);
+        CompleteStep(ucStepIdx, OS_SW_Timer_GetSystemTickCount());
+    }
+    else if(eResult == eSelfTest_Step_Error)
+    {
+        OS_SelfTest_History_Write(psSfT_State->eTestID, eSelfTest_ERROR, psSfT_State->ulRunTime, psSfT_State->ulTile);
+        TestLog(eSelfTest_ERROR);
+        SELFTEST_STOP_ON_ERROR();   // Stop on error
+    }
+    else
+    {
+        //Test is still pending.
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Executes one step of the sequence and records its execution time
+            in the cost estimation and, with SELFTEST_PROFILING, in the
+            statistic of the test. Without profiling the time is only taken
+            within a budget, the cost estimation is only used there.
+\return     none
+\param      ucStepIdx - Index into sSfT_Sequence
+***********************************************************************************/
+static void RunMeasuredStep(u8 ucStepIdx)
+{
+    teSelfTest_ID eTestID = sSfT_Sequence[ucStepIdx].eTestID;
+    bool bMeasure = (SELFTEST_PROFILING == true) || (ulSfT_BudgetLeft > 0u);
+    u32 ulStepStart = SELFTEST_STAMP(bMeasure);
+    u32 ulStepTime = 0u;
+    #if SELFTEST_PROFILING == true
+    tsSelfTest_TimeStat* psStat = &sSfT_TimeStat[eTestID];
+    #endif
+
+    RunTestStep(ucStepIdx, ulStepStart);
+
+    if(bMeasure)
+    {
+        ulStepTime = SELFTEST_GET_TIME() - ulStepStart;
+        UpdateStepCost(eTestID, ulStepTime);
+    }
+
+    #if SELFTEST_PROFILING == true                  // Always measured
+    if((psStat->ulCount == 0u) || (ulStepTime < psStat->ulMin))
+    {
+        psStat->ulMin = ulStepTime;
+    }
+    if(ulStepTime > psStat->ulMax)
+    {
+        psStat->ulMax = ulStepTime;
+    }
+
+    /* Halve sum and count before the sum overflows, the mean value stays the same */
+    if(psStat->ulSum > (0xFFFFFFFFu - ulStepTime))
+    {
+        psStat->ulSum >>= 1u;
+        psStat->ulSumCount >>= 1u;
+    }
+    psStat->ulSum += ulStepTime;
+    psStat->ulSumCount++;
+    psStat->ulCount++;
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Records the timing of a completed sequence. Called by the exit step.
+\return     none
+\param      none
+***********************************************************************************/
+static void RecordSequence(void)
+{
+    u32 ulNow = OS_SW_Timer_GetSystemTickCount();
+
+    sSfT_SeqTiming.ulLastDuration = ulSfT_Time_1;
+    if(ulSfT_Time_1 > sSfT_SeqTiming.ulMaxDuration)
+    {
+        sSfT_SeqTiming.ulMaxDuration = ulSfT_Time_1;
+    }
+
+    /* The period between two completions needs a previous completion */
+    if(sSfT_SeqTiming.ulCount)
+    {
+        u32 ulPeriod = ulNow - ulSfT_LastCompletion;
+
+        if(ulPeriod > sSfT_SeqTiming.ulMaxPeriod)
+        {
+            sSfT_SeqTiming.ulMaxPeriod = ulPeriod;
+        }
+    }
+    ulSfT_LastCompletion = ulNow;
+    sSfT_SeqTiming.ulCount++;
+    FixProgressWeights();
+}
+
+
+
+
+#if SELFTEST_FAST_BOOT == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the tests of the cyclic sequence. Uses only constant data,
+            so it can be called before HAL_MemoryInit_Init().
+\return     One bit per teSelfTest_ID
+\param      none
+***********************************************************************************/
+static u32 GetSequenceTests(void)
+{
+    u32 ulTests = 0u;
+    u8 ucIdx;
+
+    for(ucIdx = 0u; ucIdx < SELFTEST_STEP_COUNT; ucIdx++)
+    {
+        ulTests |= (1uL << sSfT_Sequence[ucIdx].eTestID);
+    }
+    return ulTests;
+}
+#endif
+
+
+#if SELFTEST_STACK_WATERMARK == true
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Unused stack which the watermark scan reads
+\return     Bytes below the high-water mark, the whole stack before the fill
+\param      none
+***********************************************************************************/
+static u32 GetStackFree(void)
+{
+    tsSelfTest_StackUsage sUsage;
+    u32 ulFree = SELFTEST_STACK_ENDADR + 1u - SELFTEST_STACK_STARTADR;
+
+    if(OS_SelfTest_Stack_GetUsage(&sUsage))
+    {
+        ulFree = sUsage.ulFree;
+    }
+    return ulFree;
+}
+#endif
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Calls of a wait for the given ticks. At one call per
+            SELFTEST_CALL_PERIOD or at the call rate measured by the time base
+            test when it is faster.
+\return     Number of calls
+\param      ulTicks - Ticks of the wait
+***********************************************************************************/
+static u32 GetWaitCalls(u32 ulTicks)
+{
+    u32 ulCalls = SELFTEST_WAIT_CALLS(ulTicks);
+
+    if(ulSfT_RateTicks)
+    {
+        u64 ullCalls = SELFTEST_DIV_CEIL((u64)ulTicks * ulSfT_RateCalls, ulSfT_RateTicks);
+
+        if(ullCalls > ulCalls)
+        {
+            ulCalls = (ullCalls > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (u32)ullCalls;
+        }
+    }
+    return ulCalls;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the worst-case number of calls of one run of a test
+            for the actual sizes of the tested memories.
+\return     Number of calls, 0 for disabled tests
+\param      eTestID - The test
+***********************************************************************************/
+static u32 GetWorstCaseCalls(teSelfTest_ID eTestID)
+{
+    u32 ulCalls = 0u;
+
+    switch(eTestID)
+    {
+        case eSelfTest_ID_CPUREG:   ulCalls = SELFTEST_CALLS_CPUREG;    break;
+        case eSelfTest_ID_CPUPC:    ulCalls = SELFTEST_CALLS_CPUPC;     break;
+        case eSelfTest_ID_TIMEBASE: ulCalls = SELFTEST_CALLS_TIMEBASE(GetWaitCalls); break;
+        case eSelfTest_ID_RAM:      ulCalls = SELFTEST_CALLS_RAM(TEST_SRAM_ENDADR - TEST_SRAM_STARTADR + 1u - SELFTEST_RAM_SKIP_SIZE); break;
+        case eSelfTest_ID_STACK:    ulCalls = SELFTEST_CALLS_STACK(GetStackFree()); break;
+        case eSelfTest_ID_STACKOVF: ulCalls = SELFTEST_CALLS_STACKOVF;  break;
+        #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+        case eSelfTest_ID_FLASH:    ulCalls = SELFTEST_CALLS_FLASH(OS_SelfTest_Flash_GetRegionBytes()); break;
+        #else
+        case eSelfTest_ID_FLASH:    ulCalls = SELFTEST_CALLS_FLASH(ulAppCodeLength); break;
+        #endif
+        case eSelfTest_ID_IO:       ulCalls = SELFTEST_CALLS_IO;        break;
+        case eSelfTest_ID_ADC:      ulCalls = SELFTEST_CALLS_ADC(GetWaitCalls); break;
+        case eSelfTest_ID_UART:     ulCalls = SELFTEST_CALLS_UART;      break;
+        case eSelfTest_ID_EXIT:     ulCalls = SELFTEST_CALLS_EXIT;      break;
+        default:                                                        break;
+    }
+    return ulCalls;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Fixes the progress weights of the pass which starts now. Each test
+            is weighted with its last complete run, before the first complete
+            pass with its worst-case calls. The weights don't change within the
+            pass, so a finished run doesn't move its progress back.
+\return     none
+\param      none
+***********************************************************************************/
+static void FixProgressWeights(void)
+{
+    u8 ucIdx;
+
+    for(ucIdx = 0u; ucIdx < SELFTEST_STEP_COUNT; ucIdx++)
+    {
+        teSelfTest_ID eTestID = sSfT_Sequence[ucIdx].eTestID;
+
+        if(sSfT_SeqTiming.ulCount != 0u)            // Each test has completed a run
+        {
+            ulSfT_WeightWork[eTestID] = ulSfT_PassWork[eTestID];
+            ulSfT_WeightSteps[eTestID] = ulSfT_PassSteps[eTestID];
+        }
+        else
+        {
+            ulSfT_WeightWork[eTestID] = GetWorstCaseCalls(eTestID);
+            ulSfT_WeightSteps[eTestID] = ulSfT_WeightWork[eTestID];
+        }
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Memory covered by a step in the running pass. A finished step
+            covers its whole memory. In SELFTEST_FLASH_MODE_REGIONS only the
+            regions due in this pass count, before their selection all regions.
+\return     Tested bytes, 0 for tests without memory
+\param      ucStepIdx - Index into sSfT_Sequence
+\param      pulSize - Receives the bytes of the pass
+***********************************************************************************/
+static u32 GetCoverage(u8 ucStepIdx, u32* pulSize)
+{
+    u32 ulDone = 0u;
+    u32 ulSize = 0u;
+
+    switch(sSfT_Sequence[ucStepIdx].eTestID)
+    {
+        #if EXEC_CYCLIC_RAM == true
+        case eSelfTest_ID_RAM:
+            ulSize = TEST_SRAM_ENDADR - TEST_SRAM_STARTADR + 1u - SELFTEST_RAM_SKIP_SIZE;
+            if(sSfT_State[ucStepIdx].ucPhase != 0u)
+            {
+                ulDone = sSfT_State[ucStepIdx].ulTestAddress - TEST_SRAM_STARTADR;
+                #if SELFTEST_RAM_SKIP_STACK == true
+                if(sSfT_State[ucStepIdx].ulTestAddress > SELFTEST_RAM_SKIP_END)
+                {
+                    ulDone -= SELFTEST_RAM_SKIP_SIZE;           // The stack isn't tested
+                }
+                #endif
+            }
+            break;
+        #endif
+
+        #if ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS )
+        case eSelfTest_ID_FLASH:
+            ulDone = OS_SelfTest_Flash_GetRegionProgress(&ulSize);
+            if((sSfT_State[ucStepIdx].ucPhase == 0u) && ((ulSfT_PassMask & (1uL << ucStepIdx)) == 0u))
+            {
+                ulDone = 0u;                            // Regions of the last pass
+                ulSize = OS_SelfTest_Flash_GetRegionBytes();
+            }
+            break;
+        #elif ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_MANIFEST )
+        case eSelfTest_ID_FLASH:
+            ulSize = ulAppCodeLength;
+            if((sSfT_State[ucStepIdx].ucPhase != 0u) && psSfT_FlashManifest)
+            {
+                ulSize = psSfT_FlashManifest->ulLength;
+                ulDone = (psSfT_FlashManifest->ulTileCount - (u32)sSfT_State[ucStepIdx].slTestCount) * psSfT_FlashManifest->ulTileSize;
+            }
+            break;
+        #elif EXEC_CYCLIC_FLASH == true
+        case eSelfTest_ID_FLASH:
+            ulSize = ulAppCodeLength;
+            if((sSfT_State[ucStepIdx].ucPhase != 0u) && (sSfT_State[ucStepIdx].slTestCount > 0))
+            {
+                ulDone = ulAppCodeLength - (u32)sSfT_State[ucStepIdx].slTestCount;
+            }
+            break;
+        #endif
+
+        default:
+            break;
+    }
+
+    if((ulSfT_PassMask & (1uL << ucStepIdx)) || (ulDone > ulSize))
+    {
+        ulDone = ulSize;
+    }
+    *pulSize = ulSize;
+    return ulDone;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Runs as many steps of the cyclic self test sequence as fit into the
+            given time budget. At least one step is executed when a test is
+            released. Further steps are only started when their estimated cost
+            fits into the remaining budget and, when yielding, no event is pending.
+\return     true when the slice was stopped by a pending event
+\param      ulBudget - Time budget of this slice in SELFTEST_GET_TIME() units
+\param      bYield - Stop as soon as SELFTEST_EVENT_PENDING()
+***********************************************************************************/
+static bool RunSlice(u32 ulBudget, bool bYield)
+{
+    u32 ulStartTime = SELFTEST_GET_TIME();
+    u32 ulElapsed = 0u;
+    u8 ucStepIdx = SelectStep(OS_SW_Timer_GetSystemTickCount());
+    bool bEvent = false;
+
+    while(ucStepIdx < SELFTEST_STEP_COUNT)
+    {
+        ulSfT_BudgetLeft = ulBudget - ulElapsed;
+        RunMeasuredStep(ucStepIdx);
+
+        ulElapsed = SELFTEST_GET_TIME() - ulStartTime;
+        ucStepIdx = SelectStep(OS_SW_Timer_GetSystemTickCount());
+        bEvent = bYield && SELFTEST_EVENT_PENDING();
+
+        if(bEvent
+        || (ulElapsed >= ulBudget)
+        || ((ucStepIdx < SELFTEST_STEP_COUNT) && (ulSfT_StepCost[sSfT_Sequence[ucStepIdx].eTestID] > (ulBudget - ulElapsed))))
+        {
+            break;
+        }
+    }
+
+    ulSfT_BudgetLeft = 0u;
+    return bEvent;
+}
+
+
+#if SELFTEST_S_ENABLE
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Records the execution time of a startup test after HAL_MemoryInit_Init().
+            While the flash check runs in the background the test is hidden
+            behind it, its time is a saving of the boot. The test during which
+            the check completes isn't counted as saving.
+\return     none
+\param      eTestID - The test
+\param      ulStart - SELFTEST_STARTUP_TIME() at the start of the test
+***********************************************************************************/
+static void RecordStartupTest(teSelfTest_ID eTestID, u32 ulStart)
+{
+    u32 ulEnd = SELFTEST_STARTUP_TIME();
+    tsSelfTest_StartupTiming* psTiming = &sSfT_StartupTiming[eTestID];
+
+    psTiming->ulTime += ulEnd - ulStart;                // The time base is tested twice
+
+    #if ( EXEC_STARTUP_FLASH == true ) && ( SELFTEST_STARTUP_OVERLAP == true )
+    if(ucSfT_StartupFlash == PASS_STILL_TESTING_STATUS)
+    {
+        ucSfT_StartupFlash = OS_SelfTest_CRC_Poll(&ulSfT_StartupCrc);
+        if(ucSfT_StartupFlash == PASS_STILL_TESTING_STATUS)
+        {
+            psTiming->ulSaving += ulEnd - ulStart;
+        }
+        else
+        {
+            sSfT_StartupTiming[eSelfTest_ID_FLASH].ulTime = ulEnd - ulSfT_StartupFlashStart;
+        }
+    }
+    #endif
+}
+
+
+#if ( EXEC_STARTUP_FLASH == true ) && ( SELFTEST_STARTUP_OVERLAP == true )
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts the CRC of the image as a job of the CRC engine. Without
+            SELFTEST_CRC_ASYNC the CRC is calculated here.
+\return     none
+\param      none
+***********************************************************************************/
+static void StartStartupFlash(void)
+{
+    ulSfT_StartupFlashStart = SELFTEST_STARTUP_TIME();
+    ucSfT_StartupFlash = OS_SelfTest_CRC_Start(SELFTEST_FLASH_PTR(ulAppCodeStart), ulAppCodeLength, CRC_INIT_VALUE);
+
+    if(ucSfT_StartupFlash == OK_STATUS)
+    {
+        ucSfT_StartupFlash = OS_SelfTest_CRC_Poll(&ulSfT_StartupCrc);
+        sSfT_StartupTiming[eSelfTest_ID_FLASH].ulTime = SELFTEST_STARTUP_TIME() - ulSfT_StartupFlashStart;
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Waits for the job of StartStartupFlash() and compares the CRC with
+            the post-link reference like the cyclic image check.
+\return     eSelfTest_OK or eSelfTest_ERROR
+\param      none
+***********************************************************************************/
+static u8 FinishStartupFlash(void)
+{
+    u8 ucResult = eSelfTest_ERROR;
+
+    while(ucSfT_StartupFlash == PASS_STILL_TESTING_STATUS)
+    {
+        ucSfT_StartupFlash = OS_SelfTest_CRC_Poll(&ulSfT_StartupCrc);
+        sSfT_StartupTiming[eSelfTest_ID_FLASH].ulTime = SELFTEST_STARTUP_TIME() - ulSfT_StartupFlashStart;
+    }
+
+    if((ucSfT_StartupFlash == PASS_COMPLETE_STATUS)
+    && (SelfTest_FlashCRCRead(ST_FLASH_SEGIDX_S1) == ~ulSfT_StartupCrc))
+    {
+        ucResult = eSelfTest_OK;
+    }
+    return ucResult;
+}
+#endif
+#endif  // SELFTEST_S_ENABLE
+
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Handles the self tests on the start up of the system.
+            When everything is fine the main taks is called.
+            On a qualified warm reset (SELFTEST_FAST_BOOT) the tests with a
+            cyclic counterpart are skipped, they are covered by the first
+            cyclic pass. The decision is held in local variables because
+            HAL_MemoryInit_Init() initializes the static variables.
+            With SELFTEST_STARTUP_OVERLAP the flash check runs on the CRC
+            engine during the tests after HAL_MemoryInit_Init().
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_StartCallback(void)
+{
+    #if SELFTEST_FAST_BOOT == true
+        const u32 ulReason = HAL_SelfTest_GetResetReason();
+        const bool bFastBoot = CheckFastBoot(ulReason);
+    #else
+        const u32 ulReason = 0u;
+        const bool bFastBoot = false;
+    #endif
+    u32 aulPreInitTime[eSelfTest_ID_COUNT] = { 0u };   // Times of the tests before HAL_MemoryInit_Init()
+    u32 ulStart;
+    u8 ucIdx;
+
+    OS_SelfTest_Time_Init();                // Time stamps of the startup tests
+
+    #if SELFTEST_S_ENABLE
+        /***** do CPU Register test before memory initialization *******/
+        #if EXEC_STARTUP_CPUREG
+            ulStart = SELFTEST_STARTUP_TIME();
+            if(HAL_SelfTest_CPU_Reg())
+            {
+                 while(1u);               // !!! Stop on error.
+            }
+            aulPreInitTime[eSelfTest_ID_CPUREG] = SELFTEST_STARTUP_TIME() - ulStart;
+        #endif
+
+        /***** do CPU program counter test before memory initialization ******/
+        #if EXEC_STARTUP_CPUPC
+            ulStart = SELFTEST_STARTUP_TIME();
+            if (HAL_SelfTest_CPU_PC())
+            {
+                while(1u);                // !!! Stop on error.
+            }
+            aulPreInitTime[eSelfTest_ID_CPUPC] = SELFTEST_STARTUP_TIME() - ulStart;
+        #endif
+
+        /****** do SRAM test before memory initialization *******/
+        #if EXEC_STARTUP_RAM
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_RAM))
+            {
+                ulStart = SELFTEST_STARTUP_TIME();
+                if (HAL_SelfTest_RAM())          // !!! don't return on error.
+                {
+                    while(1u);                // !!! Stop on error.
+                }
+                aulPreInitTime[eSelfTest_ID_RAM] = SELFTEST_STARTUP_TIME() - ulStart;
+            }
+        #endif
+
+        /****** do Stack test before memory initialization *******/
+        #if EXEC_STARTUP_STACK
+            /* Initialize self-test stack */
+            ulStart = SELFTEST_STARTUP_TIME();
+            HAL_SelfTest_Stack_Init();
+
+            if (HAL_SelfTest_Stack_Check())         // !!! don't return on error.
+            {
+                while(1u);               // !!! Stop on error.
+            }
+            aulPreInitTime[eSelfTest_ID_STACK] = SELFTEST_STARTUP_TIME() - ulStart;
+        #endif
+    #endif  // SELFTEST_S_ENABLE
+
+    /* Initialize standard memory */
+    HAL_MemoryInit_Init();
+    HAL_SelfTest_Stack_Init();
+    #if EXEC_CYCLIC_STACK == true
+        OS_SelfTest_Stack_Fill();           // Interrupts are still disabled
+    #endif
+
+    ulResetReason = ulReason;
+    bSfT_FastBoot = bFastBoot;
+    #if SELFTEST_FAST_BOOT == true
+        WriteBootRecord(ulReason, bFastBoot);
+    #endif
+    for(ucIdx = 0u; ucIdx < eSelfTest_ID_COUNT; ucIdx++)
+    {
+        sSfT_StartupTiming[ucIdx].ulTime = aulPreInitTime[ucIdx];
+        sSfT_StartupTiming[ucIdx].ulSaving = 0u;
+    }
+    (void)ulStart;                          // Without startup tests
+
+    #if SELFTEST_S_ENABLE
+
+        //***** start FLASH test in the background AFTER memory initialization
+        // The CRC engine checks the image during the following tests !!! //
+        #if ( EXEC_STARTUP_FLASH == true ) && ( SELFTEST_STARTUP_OVERLAP == true )
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_FLASH))
+            {
+                StartStartupFlash();
+            }
+        #endif
+
+        //***** do Interrupt and time-base test AFTER memory initialization
+        // Using CyDelayUS needs initialized memory !!! //
+        #if EXEC_STARTUP_INTERRUPT
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_TIMEBASE))
+            {
+                ulStart = SELFTEST_STARTUP_TIME();
+                if(HAL_SelfTest_TimeBase())
+                {
+                    while(1u);                // !!! Stop on error.
+                }
+                RecordStartupTest(eSelfTest_ID_TIMEBASE, ulStart);
+            }
+        #endif
+
+        //***** do FLASH test AFTER memory initialization
+        // Needs initialized memory !!! //
+        #if ( EXEC_STARTUP_FLASH == true ) && ( SELFTEST_STARTUP_OVERLAP != true )
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_FLASH))
+            {
+                ulStart = SELFTEST_STARTUP_TIME();
+                if ( HAL_SelfTest_Flash()!= eSelfTest_OK )
+                {
+                    while(1u);               // !!! Stop on error.
+                }
+                RecordStartupTest(eSelfTest_ID_FLASH, ulStart);
+            }
+        #endif
+
+        //***** do ADC SAR test AFTER memory initialization ! //
+        #if EXEC_STARTUP_ADC
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_ADC))
+            {
+                ulStart = SELFTEST_STARTUP_TIME();
+                if(HAL_SelfTest_ADC())
+                {
+                    while(1u);                // !!! Stop on error.
+                }
+                RecordStartupTest(eSelfTest_ID_ADC, ulStart);
+            }
+        #endif
+
+        //***** do UART_1 test AFTER memory initialization ! //
+        #if EXEC_STARTUP_UART
+            HAL_SelfTest_UART_Init();
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_UART))
+            {
+                ulStart = SELFTEST_STARTUP_TIME();
+                if (HAL_SelfTest_UART_Check())
+                {
+                    while(1u);                // !!! Stop on error.
+                }
+                RecordStartupTest(eSelfTest_ID_UART, ulStart);
+            }
+        #endif
+        
+        //***** do Time base self-test !//
+        #if EXEC_STARTUP_TIMEBASE
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_TIMEBASE))
+            {
+                ulStart = SELFTEST_STARTUP_TIME();
+                if(HAL_SelfTest_TimeBase_StartUp())
+                {
+                    while(1u);               // !!! Stop on error 
+                }
+                RecordStartupTest(eSelfTest_ID_TIMEBASE, ulStart);
+            }
+        #endif
+
+        //***** collect the FLASH test of the background job !//
+        #if ( EXEC_STARTUP_FLASH == true ) && ( SELFTEST_STARTUP_OVERLAP == true )
+            if(SELFTEST_RUN_STARTUP(bFastBoot, EXEC_CYCLIC_FLASH))
+            {
+                if(FinishStartupFlash() != eSelfTest_OK)
+                {
+                    while(1u);               // !!! Stop on error.
+                }
+            }
+        #endif
+
+    #endif  // SELFTEST_S_ENABLE
+
+     /* Start with OS-Main-Task */
+    (void)main();
+
+    while(1);        // If main returns, make sure we don't return.
+}
+
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       20.01.2019
+\brief      Runs one step of the cyclic self test sequence.
+            Returns without a step when no test is released.
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_Cyclic_Run(void)                       // Run the sequence of cyclic tests
+{
+    u8 ucStepIdx = SelectStep(OS_SW_Timer_GetSystemTickCount());
+
+    ulSfT_BudgetLeft = 0u;                               // One step with fixed tile sizes
+    if(ucStepIdx < SELFTEST_STEP_COUNT)
+    {
+        RunMeasuredStep(ucStepIdx);
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Runs as many steps of the cyclic self test sequence as fit into the
+            given time budget. At least one step is executed on each call when a
+            test is released, so the sequence always progresses. Further steps are
+            only started when their estimated cost fits into the remaining budget.
+            SRAM march and flash CRC tiles are sized to the remaining budget,
+            a background CRC job to complete within the slice. A budget below
+            the cost of the smallest tile is still exceeded by that tile.
+\return     none
+\param      ulBudget - Time budget of this slice in SELFTEST_GET_TIME() units
+***********************************************************************************/
+void OS_SelfTest_Cyclic_RunBudget(u32 ulBudget)
+{
+    (void)RunSlice(ulBudget, false);
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Idle hook mode. Called from the idle hook of the OS, runs slices
+            of SELFTEST_IDLE_SLICE_TIME until an event is pending or
+            SELFTEST_IDLE_MAX_SLICES slices are done.
+            Replaces the calls of OS_SelfTest_Cyclic_Run().
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_IdleHook(void)
+{
+    u8 ucSlice;
+    bool bEvent = SELFTEST_EVENT_PENDING();
+
+    for(ucSlice = 0u; (ucSlice < SELFTEST_IDLE_MAX_SLICES) && (bEvent == false); ucSlice++)
+    {
+        bEvent = RunSlice(SELFTEST_IDLE_SLICE_TIME, true);
+        ulSfT_LastSlice = OS_SW_Timer_GetSystemTickCount();
+        sSfT_IdleStats.ulIdleSlices++;
+    }
+
+    if(bEvent)
+    {
+        sSfT_IdleStats.ulYields++;
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Guaranteed minimum of the idle hook mode. Called from a periodic
+            task, runs one slice of SELFTEST_IDLE_FALLBACK_TIME when the idle
+            hook had no slice for SELFTEST_IDLE_FALLBACK_TICKS, so the tests
+            progress also under sustained load.
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_IdleFallback(void)
+{
+    u32 ulNow = OS_SW_Timer_GetSystemTickCount();
+
+    if((ulNow - ulSfT_LastSlice) >= SELFTEST_IDLE_FALLBACK_TICKS)
+    {
+        (void)RunSlice(SELFTEST_IDLE_FALLBACK_TIME, false);
+        ulSfT_LastSlice = ulNow;
+        sSfT_IdleStats.ulFallbackSlices++;
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the slice statistic of the idle hook mode
+\return     none
+\param      psStats - Receives the statistic
+***********************************************************************************/
+void OS_SelfTest_GetIdleStats(tsSelfTest_IdleStats* psStats)
+{
+    if(psStats)
+    {
+        *psStats = sSfT_IdleStats;
+    }
+}
+
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       19.04.2020
+\brief      Initializes the structure for the cyclical callback
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_InitCyclic(void)                         // Prepare the sequence of cyclic tests
+{
+    u32 ulNow = OS_SW_Timer_GetSystemTickCount();
+    u8 ucIdx;
+
+    for(ucIdx = 0u; ucIdx < SELFTEST_STEP_COUNT; ucIdx++)
+    {
+        psSfT_State = &sSfT_State[ucIdx];
+        psSfT_State->eTestID = sSfT_Sequence[ucIdx].eTestID;
+        psSfT_State->ucPhase = 0u;
+        psSfT_State->slTestCount = 0u;
+        psSfT_State->ulTestOffset = 0u;
+        psSfT_State->ulRelease = ulNow;                 // All tests are released with the start
+        psSfT_State->ulDeadlineMisses = 0u;
+        psSfT_State->ulTile = 0u;
+        psSfT_State->ulRunTime = 0u;
+    }
+    psSfT_State = &sSfT_State[0];
+
+    psSfT_Log  = &sSfT_Log;
+    psSfT_Log->sLastResult.eResultCode = 0u;
     psSfT_Log->sLastResult.eTestID = 0u;
-    psSfT_State->slTestCount = 0u;
-    psSfT_State->ulTestOffset = 0u;
+
+    ulSfT_PassMask = 0u;
+    ulSfT_Time_0 = ulNow;                               // Start duration timer of the first pass
+    ulSfT_LastSlice = ulNow;
+    FixProgressWeights();
+
+    #if ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_CRC_ASYNC == true )
+        ulSfT_FlashJobSize = 0u;                        // No measurement of a job of the last sequence
+    #endif
+    #if ( EXEC_CYCLIC_FLASH == true ) && ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS )
+        OS_SelfTest_Flash_InitRegions();
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the execution time statistic of a test.
+            Times are in SELFTEST_GET_TIME() units.
+\return     true when the test ID is valid, false without SELFTEST_PROFILING
+\param      eTestID - The test
+\param      psStats - Receives the statistic
+***********************************************************************************/
+bool OS_SelfTest_GetTestTiming(teSelfTest_ID eTestID, tsSelfTest_TimingStats* psStats)
+{
+    bool bValid = false;
+
+    #if SELFTEST_PROFILING == true
+    if(psStats && ((u32)eTestID < eSelfTest_ID_COUNT))
+    {
+        const tsSelfTest_TimeStat* psStat = &sSfT_TimeStat[eTestID];
+
+        psStats->ulMin = psStat->ulMin;
+        psStats->ulMax = psStat->ulMax;
+        psStats->ulMean = psStat->ulSumCount ? (psStat->ulSum / psStat->ulSumCount) : 0u;
+        psStats->ulCount = psStat->ulCount;
+        bValid = true;
+    }
+    #else
+    (void)eTestID;
+    (void)psStats;
+    #endif
+    return bValid;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the interrupt lock statistic of a test. Only the SRAM
+            tiles and the stack check are measured.
+            Times are in SELFTEST_GET_TIME() units.
+\return     true when the test ID is valid, false without SELFTEST_PROFILING
+\param      eTestID - The test
+\param      psStats - Receives the statistic
+***********************************************************************************/
+bool OS_SelfTest_GetLockTime(teSelfTest_ID eTestID, tsSelfTest_LockStats* psStats)
+{
+    bool bValid = false;
+
+    #if SELFTEST_PROFILING == true
+    if(psStats && ((u32)eTestID < eSelfTest_ID_COUNT))
+    {
+        psStats->ulMaxLock = sSfT_LockStat[eTestID].ulMax;
+        psStats->ulLimit = SELFTEST_MAX_LOCK_TIME;
+        psStats->ulExceeded = sSfT_LockStat[eTestID].ulExceeded;
+        bValid = true;
+    }
+    #else
+    (void)eTestID;
+    (void)psStats;
+    #endif
+    return bValid;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the timing of the complete cyclic sequence.
+            Times are in system ticks.
+\return     none
+\param      psTiming - Receives the sequence timing
+***********************************************************************************/
+void OS_SelfTest_GetSequenceTiming(tsSelfTest_SequenceTiming* psTiming)
+{
+    if(psTiming)
+    {
+        *psTiming = sSfT_SeqTiming;
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns how often a test finished after its deadline
+            (SELFTEST_DEADLINE_xxx ticks after its release).
+\return     Number of deadline misses, 0 for disabled tests
+\param      eTestID - The test
+***********************************************************************************/
+u32 OS_SelfTest_GetDeadlineMisses(teSelfTest_ID eTestID)
+{
+    u32 ulMisses = 0u;
+    u8 ucIdx;
+
+    for(ucIdx = 0u; ucIdx < SELFTEST_STEP_COUNT; ucIdx++)
+    {
+        if(sSfT_Sequence[ucIdx].eTestID == eTestID)
+        {
+            ulMisses = sSfT_State[ucIdx].ulDeadlineMisses;
+        }
+    }
+    return ulMisses;
+}
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Worst-case fault reaction time of one cyclic pass.
+            The calls are calculated from the configuration, the actual
+            memory sizes and the measured call rate, the execution time from
+            the longest measured step of each test. A periodic test counts
+            with each of its runs within the pass, the pass time is iterated
+            until these runs fit into it (response time analysis). The pass
+            time is the longer one of the call based time and the worst
+            measured period between two completed passes.
+            A pass whose iteration doesn't converge has no bound, its calls,
+            ticks and execution time are SELFTEST_REACTION_NO_BOUND.
+\return     true when the pass has a bound and it is within
+            SELFTEST_FAULT_REACTION_TIME or no fault reaction time is declared
+\param      psReaction - Filled with the analysis, may be NULL
+***********************************************************************************/
+bool OS_SelfTest_GetReactionTime(tsSelfTest_ReactionTime* psReaction)
+{
+    tsSelfTest_ReactionTime sReaction;
+    u32 aulCalls[SELFTEST_STEP_COUNT];
+    u64 ullCalls = 0u;
+    u64 ullTicks = 0u;
+    u64 ullExecTime = 0u;
+    s64 sllMargin;
+    bool bBound;
+    u8 ucRound;
+    u8 ucIdx;
+
+    for(ucIdx = 0u; ucIdx < SELFTEST_STEP_COUNT; ucIdx++)
+    {
+        aulCalls[ucIdx] = GetWorstCaseCalls(sSfT_Sequence[ucIdx].eTestID);
+        ullCalls += aulCalls[ucIdx];
+    }
+
+    /* The periodic tests released within the pass make it longer, which releases them again.
+       Stops when the pass doesn't grow any more or can't meet any deadline */
+    for(ucRound = 0u; (ucRound < SELFTEST_RTA_ROUNDS) && (ullCalls * SELFTEST_CALL_PERIOD != ullTicks) && (ullTicks <= 0xFFFFFFFFu); ucRound++)
+    {
+        ullTicks = ullCalls * SELFTEST_CALL_PERIOD;
+        ullCalls = 0u;
+        for(ucIdx = 0u; ucIdx < SELFTEST_STEP_COUNT; ucIdx++)
+        {
+            ullCalls += (u64)aulCalls[ucIdx] * SELFTEST_RUNS(ullTicks, sSfT_Sequence[ucIdx].ulPeriod);
+        }
+    }
+    bBound = (ullCalls * SELFTEST_CALL_PERIOD == ullTicks) && (ullTicks < SELFTEST_REACTION_NO_BOUND);
+
+    #if SELFTEST_PROFILING == true
+    for(ucIdx = 0u; bBound && (ucIdx < SELFTEST_STEP_COUNT); ucIdx++)
+    {
+        teSelfTest_ID eTestID = sSfT_Sequence[ucIdx].eTestID;
+
+        ullExecTime += (u64)aulCalls[ucIdx] * SELFTEST_RUNS(ullTicks, sSfT_Sequence[ucIdx].ulPeriod) * sSfT_TimeStat[eTestID].ulMax;
+        if(ullExecTime > SELFTEST_REACTION_NO_BOUND)
+        {
+            ullExecTime = SELFTEST_REACTION_NO_BOUND;
+        }
+    }
+    #endif
+
+    if(bBound)
+    {
+        sReaction.ulCalls = (u32)ullCalls;
+        sReaction.ulTicks = (u32)ullTicks;
+        sReaction.ulExecTime = (u32)ullExecTime;
+    }
+    else
+    {
+        sReaction.ulCalls = SELFTEST_REACTION_NO_BOUND;
+        sReaction.ulTicks = SELFTEST_REACTION_NO_BOUND;
+        sReaction.ulExecTime = SELFTEST_REACTION_NO_BOUND;
+    }
+
+    if(sSfT_SeqTiming.ulMaxPeriod > sReaction.ulTicks)
+    {
+        sReaction.ulTicks = sSfT_SeqTiming.ulMaxPeriod;
+    }
+
+    /* Margin without wrap around, a pass far behind the deadline stays negative */
+    sReaction.ulDeadline = SELFTEST_FAULT_REACTION_TIME;
+    sllMargin = (s64)sReaction.ulDeadline - (s64)sReaction.ulTicks;
+    if(sllMargin > (s64)0x7FFFFFFF)
+    {
+        sllMargin = (s64)0x7FFFFFFF;
+    }
+    else if(sllMargin < -(s64)0x80000000)
+    {
+        sllMargin = -(s64)0x80000000;
+    }
+    sReaction.slMargin = (s32)sllMargin;
+
+    if(psReaction)
+    {
+        *psReaction = sReaction;
+    }
+    return bBound && ((sReaction.ulDeadline == 0u) || (sReaction.ulTicks <= sReaction.ulDeadline));
+}
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Progress of the running cyclic pass. Each test is weighted with the
+            execution time of its last run before this pass ( its steps without
+            SELFTEST_PROFILING ), in the first pass with its worst-case calls,
+            see FixProgressWeights(). A finished test counts
+            completely, the SRAM and flash tests with their tested bytes, the
+            other tests with their executed steps.
+            The remaining time is extrapolated from the rate of this pass, in
+            its first tenth from the last complete pass.
+            A supervisor may add self-test slices while bBehind is set.
+\return     none
+\param      psProgress - Receives the progress
+***********************************************************************************/
+void OS_SelfTest_GetProgress(tsSelfTest_Progress* psProgress)
+{
+    tsSelfTest_Progress sProgress;
+    bool bMeasured = (sSfT_SeqTiming.ulCount != 0u);   // Each test has completed a run
+    u64 ullTotal = 0u;                              // Weight of the pass
+    u64 ullDone = 0u;                               // Finished part of ullTotal
+    u32 ulPermille;
+    u8 ucIdx;
+
+    sProgress.ulRamBytes = 0u;
+    sProgress.ulRamSize = 0u;
+    sProgress.ulFlashBytes = 0u;
+    sProgress.ulFlashSize = 0u;
+
+    for(ucIdx = 0u; (ucIdx + 1u) < SELFTEST_STEP_COUNT; ucIdx++)
+    {
+        const tsSelfTest_State* psState = &sSfT_State[ucIdx];
+        teSelfTest_ID eTestID = sSfT_Sequence[ucIdx].eTestID;
+        u64 ullWeight = ulSfT_WeightWork[eTestID];
+        u32 ulSteps = ulSfT_WeightSteps[eTestID];
+        u32 ulSize = 0u;
+        u32 ulDone = GetCoverage(ucIdx, &ulSize);
+
+        if(eTestID == eSelfTest_ID_RAM)
+        {
+            sProgress.ulRamBytes = ulDone;
+            sProgress.ulRamSize = ulSize;
+        }
+        else if(eTestID == eSelfTest_ID_FLASH)
+        {
+            sProgress.ulFlashBytes = ulDone;
+            sProgress.ulFlashSize = ulSize;
+        }
+        else
+        {
+            // No memory
+        }
+
+        ullTotal += ullWeight;
+        if(ulSfT_PassMask & (1uL << ucIdx))
+        {
+            ullDone += ullWeight;
+        }
+        else if(ulSize)
+        {
+            ullDone += (ullWeight * (((u64)ulDone * 1000u) / ulSize)) / 1000u;
+        }
+        else if(psState->ulTile && ulSteps)
+        {
+            ullDone += (ullWeight * ((psState->ulTile < ulSteps) ? psState->ulTile : (ulSteps - 1u))) / ulSteps;
+        }
+        else
+        {
+            // Not started in this pass
+        }
+    }
+
+    ulPermille = ullTotal ? (u32)((ullDone * 1000u) / ullTotal) : 1000u;
+    sProgress.ulPercent = ulPermille / 10u;
+    sProgress.ulElapsed = OS_SW_Timer_GetSystemTickCount() - ulSfT_Time_0;
+    sProgress.ulLastPass = sSfT_SeqTiming.ulLastDuration;
+
+    if(bMeasured && (ulPermille < 100u))
+    {
+        sProgress.ulRemaining = (u32)(((u64)sSfT_SeqTiming.ulLastDuration * (1000u - ulPermille)) / 1000u);
+    }
+    else if(ulPermille)
+    {
+        sProgress.ulRemaining = (u32)(((u64)sProgress.ulElapsed * (1000u - ulPermille)) / ulPermille);
+    }
+    else
+    {
+        sProgress.ulRemaining = (u32)(ullTotal * SELFTEST_CALL_PERIOD);    // Worst-case calls of the first pass
+    }
+
+    sProgress.ulDeadline = SELFTEST_FAULT_REACTION_TIME;
+    sProgress.bBehind = (sProgress.ulDeadline != 0u)
+                     && (((u64)sProgress.ulElapsed + sProgress.ulRemaining) > sProgress.ulDeadline);
+
+    if(psProgress)
+    {
+        *psProgress = sProgress;
+    }
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the time of the last complete run of a test, from its first
+            step to its completion. Periodic tests may run several times per pass.
+\return     Ticks, 0 before the first run or for disabled tests
+\param      eTestID - The test
+***********************************************************************************/
+u32 OS_SelfTest_GetPassTime(teSelfTest_ID eTestID)
+{
+    u32 ulTicks = 0u;
+
+    if((u32)eTestID < eSelfTest_ID_COUNT)
+    {
+        ulTicks = ulSfT_PassTime[eTestID];
+    }
+    return ulTicks;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the timing of a startup test of the last boot. The boot was
+            shortened by the sum of the savings of all tests. The time of the
+            overlapped flash check runs from its start to the collection of its
+            result. Times are in SELFTEST_GET_TIME() units.
+\return     true when the test ID is valid, false without SELFTEST_PROFILING
+\param      eTestID - The test
+\param      psTiming - Receives the timing
+***********************************************************************************/
+bool OS_SelfTest_GetStartupTiming(teSelfTest_ID eTestID, tsSelfTest_StartupTiming* psTiming)
+{
+    bool bValid = false;
+
+    #if SELFTEST_PROFILING == true
+    if(psTiming && ((u32)eTestID < eSelfTest_ID_COUNT))
+    {
+        *psTiming = sSfT_StartupTiming[eTestID];
+        bValid = true;
+    }
+    #else
+    (void)eTestID;
+    (void)psTiming;
+    #endif
+    return bValid;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns if the startup skipped the tests with a cyclic counterpart.
+            Those tests are covered when the first cyclic pass is completed.
+\return     true after a fast boot
+\param      none
+***********************************************************************************/
+bool OS_SelfTest_IsFastBoot(void)
+{
+    return bSfT_FastBoot;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the reset cause read on startup
+\return     SELFTEST_RESET_xxx bits, 0 when unknown or SELFTEST_FAST_BOOT is off
+\param      none
+***********************************************************************************/
+u32 OS_SelfTest_GetResetReason(void)
+{
+    return ulResetReason;
 }
 
 #endif //USE_OS_SELF_TEST
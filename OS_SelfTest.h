@@ -25,6 +25,14 @@
 #define ERROR_STATUS                (1u)
 #define PASS_STILL_TESTING_STATUS   (2u)
 #define PASS_COMPLETE_STATUS        (3u)
+
+// Reset causes returned by HAL_SelfTest_GetResetReason(), 0 = unknown
+#define SELFTEST_RESET_POWER_ON     (0x01u)
+#define SELFTEST_RESET_BROWNOUT     (0x02u)
+#define SELFTEST_RESET_EXTERNAL     (0x04u)
+#define SELFTEST_RESET_WATCHDOG     (0x08u)
+#define SELFTEST_RESET_SOFTWARE     (0x10u)
+#define SELFTEST_RESET_LOCKUP       (0x20u)
     
     
 // Defines for timing tests 
@@ -54,6 +62,93 @@ typedef enum
    eSelfTest_NotExecuted                // STest Not executed
 } teSelfTest_ResultCode;
 
+// IDs of the cyclic tests
+typedef enum
+{
+   eSelfTest_ID_INIT,                   // STest init, no test executed yet
+   eSelfTest_ID_CPUREG,                 // STest CPU register
+   eSelfTest_ID_CPUPC,                  // STest CPU program counter
+   eSelfTest_ID_TIMEBASE,               // STest Timebase
+   eSelfTest_ID_RAM,                    // STest SRAM
+   eSelfTest_ID_STACK,                  // STest STACK exec
+   eSelfTest_ID_STACKOVF,               // STest STACK limit exec
+   eSelfTest_ID_FLASH,                  // STest Flash
+   eSelfTest_ID_IO,                     // STest IO
+   eSelfTest_ID_ADC,                    // STest ADC
+   eSelfTest_ID_UART,                   // STest UART
+   eSelfTest_ID_EXIT,                   // STest exit
+   eSelfTest_ID_COUNT                   // Number of IDs, not a test
+}teSelfTest_ID;
+
+//*** Execution time statistic of a cyclic test *****
+typedef struct
+{
+    u32 ulMin;                          // Shortest step
+    u32 ulMax;                          // Longest step
+    u32 ulMean;                         // Mean step time
+    u32 ulCount;                        // Number of executed steps
+} tsSelfTest_TimingStats;
+
+//*** Timing of the complete cyclic sequence *****
+typedef struct
+{
+    u32 ulLastDuration;                 // Wall time of the last complete sequence
+    u32 ulMaxDuration;                  // Longest complete sequence
+    u32 ulMaxPeriod;                    // Worst case between two sequence completions
+    u32 ulCount;                        // Number of completed sequences
+} tsSelfTest_SequenceTiming;
+
+//*** Interrupt lock statistic of a cyclic test *****
+typedef struct
+{
+    u32 ulMaxLock;                      // Longest measured lock window
+    u32 ulLimit;                        // SELFTEST_MAX_LOCK_TIME, 0 = not limited
+    u32 ulExceeded;                     // Lock windows longer than the limit
+} tsSelfTest_LockStats;
+
+//*** Slice statistic of the idle hook mode *****
+typedef struct
+{
+    u32 ulIdleSlices;                   // Slices run by OS_SelfTest_IdleHook()
+    u32 ulFallbackSlices;               // Slices run by OS_SelfTest_IdleFallback()
+    u32 ulYields;                       // Idle hook calls stopped by a pending event
+} tsSelfTest_IdleStats;
+
+//*** Worst-case fault reaction time of one cyclic pass *****
+#define SELFTEST_REACTION_NO_BOUND      0xFFFFFFFFu     // Pass without bound, the periodic tests may hold it off
+
+typedef struct
+{
+    u32 ulCalls;                        // Calls of OS_SelfTest_Cyclic_Run() for one pass, or SELFTEST_REACTION_NO_BOUND
+    u32 ulTicks;                        // Worst pass time in ticks, or SELFTEST_REACTION_NO_BOUND
+    u32 ulExecTime;                     // Sum of the longest steps, SELFTEST_GET_TIME() units, 0 without SELFTEST_PROFILING,
+                                        // SELFTEST_REACTION_NO_BOUND without bound
+    u32 ulDeadline;                     // Declared fault reaction time, 0 = none
+    s32 slMargin;                       // Ticks left to the deadline, negative when exceeded
+} tsSelfTest_ReactionTime;
+
+//*** Progress of the running cyclic pass *****
+typedef struct
+{
+    u32 ulRamBytes;                     // SRAM bytes tested in this pass
+    u32 ulRamSize;                      // SRAM bytes of a pass
+    u32 ulFlashBytes;                   // Flash bytes checked in this pass
+    u32 ulFlashSize;                    // Flash bytes of this pass
+    u32 ulPercent;                      // Completion of the pass, weighted with the calls of the tests
+    u32 ulElapsed;                      // Ticks since the start of the pass
+    u32 ulRemaining;                    // Estimated ticks to the end of the pass
+    u32 ulLastPass;                     // Ticks of the last complete pass, 0 before the first one
+    u32 ulDeadline;                     // Declared fault reaction time, 0 = none
+    bool bBehind;                       // The estimated end of the pass is after the deadline
+} tsSelfTest_Progress;
+
+//*** Timing of a startup test *****
+typedef struct
+{
+    u32 ulTime;                         // Execution time, 0 = not executed or without SELFTEST_PROFILING
+    u32 ulSaving;                       // Part of ulTime hidden behind the background flash check
+} tsSelfTest_StartupTiming;
+
 /***************************** global variables ******************************/
 // Variables used in isr_1 test interrupt handler
 static volatile u32 uSfTtInterruptCnt;
@@ -66,7 +161,21 @@ extern "C"
 
 void OS_SelfTest_InitCyclic(void);
 void OS_SelfTest_Cyclic_Run(void);
+void OS_SelfTest_Cyclic_RunBudget(u32 ulBudget);
+void OS_SelfTest_IdleHook(void);
+void OS_SelfTest_IdleFallback(void);
+void OS_SelfTest_GetIdleStats(tsSelfTest_IdleStats* psStats);
 void OS_SelfTest_StartCallback(void);
+bool OS_SelfTest_GetTestTiming(teSelfTest_ID eTestID, tsSelfTest_TimingStats* psStats);
+void OS_SelfTest_GetSequenceTiming(tsSelfTest_SequenceTiming* psTiming);
+u32 OS_SelfTest_GetDeadlineMisses(teSelfTest_ID eTestID);
+bool OS_SelfTest_GetLockTime(teSelfTest_ID eTestID, tsSelfTest_LockStats* psStats);
+bool OS_SelfTest_GetReactionTime(tsSelfTest_ReactionTime* psReaction);
+void OS_SelfTest_GetProgress(tsSelfTest_Progress* psProgress);
+u32 OS_SelfTest_GetPassTime(teSelfTest_ID eTestID);
+bool OS_SelfTest_GetStartupTiming(teSelfTest_ID eTestID, tsSelfTest_StartupTiming* psTiming);
+bool OS_SelfTest_IsFastBoot(void);
+u32 OS_SelfTest_GetResetReason(void);
 
 #ifdef __cplusplus
 }
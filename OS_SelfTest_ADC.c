@@ -0,0 +1,192 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_ADC
+\details    Non-intrusive ADC test in free conversion slots. See OS_SelfTest_ADC.h
+*/
+
+#include "OS_SelfTest_ADC.h"
+
+#ifdef USE_OS_SELF_TEST
+
+#include "OS_SelfTest.h"
+
+/****************************************** Defines ******************************************************/
+//*** Handshake with the ADC driver *****
+typedef enum
+{
+    eSelfTest_Adc_Idle,                 // No conversion requested
+    eSelfTest_Adc_Requested,            // Waiting for a free slot
+    eSelfTest_Adc_Converting,           // Handed over to the driver
+    eSelfTest_Adc_Done                  // Result available
+} teSelfTest_AdcSlot;
+
+
+/****************************************** Variables ****************************************************/
+#if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+static const tsSelfTest_AdcReference sSfT_AdcReference[SELFTEST_ADC_REFERENCE_COUNT] = SELFTEST_ADC_REFERENCES;
+
+// Written by the test and the ADC driver, the state tells who owns the slot
+static volatile u8 ucSfT_AdcSlot = eSelfTest_Adc_Idle;
+static volatile u16 usSfT_AdcValue = 0u;
+static u32 ulSfT_AdcReference = 0u;     // Index of the converted reference
+static u32 ulSfT_AdcRequest = 0u;       // Time tick of the request
+#endif
+
+
+/****************************************** Function prototypes ******************************************/
+
+extern u32 OS_SW_Timer_GetSystemTickCount( void );
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts the test with the first reference. A conversion still
+            owned by the driver is dropped with its result.
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_ADC_Start(void)
+{
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+    ulSfT_AdcReference = 0u;
+    ulSfT_AdcRequest = OS_SW_Timer_GetSystemTickCount();
+    ucSfT_AdcSlot = eSelfTest_Adc_Requested;
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks an arrived result against the tolerance window of its
+            reference and requests the next reference. Never waits.
+\return     PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS when all references
+            passed or ERROR_STATUS
+\param      none
+***********************************************************************************/
+u8 OS_SelfTest_ADC_Poll(void)
+{
+    u8 ucResult = PASS_STILL_TESTING_STATUS;
+
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+    if(ucSfT_AdcSlot == eSelfTest_Adc_Done)
+    {
+        const tsSelfTest_AdcReference* psReference = &sSfT_AdcReference[ulSfT_AdcReference];
+        u16 usValue = usSfT_AdcValue;
+        u16 usDeviation = (usValue > psReference->usExpected) ? (u16)(usValue - psReference->usExpected)
+                                                              : (u16)(psReference->usExpected - usValue);
+
+        if(usDeviation > psReference->usTolerance)
+        {
+            ucSfT_AdcSlot = eSelfTest_Adc_Idle;
+            ucResult = ERROR_STATUS;
+        }
+        else if(++ulSfT_AdcReference >= SELFTEST_ADC_REFERENCE_COUNT)
+        {
+            ucSfT_AdcSlot = eSelfTest_Adc_Idle;
+            ucResult = PASS_COMPLETE_STATUS;
+        }
+        else
+        {
+            ulSfT_AdcRequest = OS_SW_Timer_GetSystemTickCount();
+            ucSfT_AdcSlot = eSelfTest_Adc_Requested;
+        }
+    }
+    else if((ucSfT_AdcSlot != eSelfTest_Adc_Idle)
+         && ((OS_SW_Timer_GetSystemTickCount() - ulSfT_AdcRequest) > SELFTEST_ADC_SLOT_TIMEOUT))
+    {
+        ucSfT_AdcSlot = eSelfTest_Adc_Idle;
+        ucResult = ERROR_STATUS;                // No free slot or no result
+    }
+    else if(ucSfT_AdcSlot == eSelfTest_Adc_Idle)
+    {
+        ucResult = ERROR_STATUS;                // Not started
+    }
+    #else
+    ucResult = ERROR_STATUS;
+    #endif
+
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Called by the ADC driver of the application when its conversion
+            sequence has a free slot.
+\return     true when the slot shall convert the returned channel, the result
+            is expected in OS_SelfTest_ADC_SlotResult()
+\param      pucChannel - Receives the channel to convert
+***********************************************************************************/
+bool OS_SelfTest_ADC_GetSlotRequest(u8* pucChannel)
+{
+    bool bRequest = false;
+
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+    if(pucChannel && (ucSfT_AdcSlot == eSelfTest_Adc_Requested))
+    {
+        *pucChannel = sSfT_AdcReference[ulSfT_AdcReference].ucChannel;
+        ucSfT_AdcSlot = eSelfTest_Adc_Converting;
+        bRequest = true;
+    }
+    #else
+    (void)pucChannel;
+    #endif
+
+    return bRequest;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Called by the ADC driver, also from its ISR, with the result of a
+            slot conversion requested by OS_SelfTest_ADC_GetSlotRequest().
+            Results of other channels are ignored.
+\return     none
+\param      ucChannel - The converted channel
+\param      usValue - Conversion result
+***********************************************************************************/
+void OS_SelfTest_ADC_SlotResult(u8 ucChannel, u16 usValue)
+{
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+    if((ucSfT_AdcSlot == eSelfTest_Adc_Converting) && (ucChannel == sSfT_AdcReference[ulSfT_AdcReference].ucChannel))
+    {
+        usSfT_AdcValue = usValue;
+        ucSfT_AdcSlot = eSelfTest_Adc_Done;     // Hand the slot back to the test
+    }
+    #else
+    (void)ucChannel;
+    (void)usValue;
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Number of reference channels of the slot test
+\return     Number of references, 0 without SELFTEST_ADC_MODE_SLOT
+\param      none
+***********************************************************************************/
+u32 OS_SelfTest_ADC_GetReferenceCount(void)
+{
+    #if SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT
+        return SELFTEST_ADC_REFERENCE_COUNT;
+    #else
+        return 0u;
+    #endif
+}
+
+#endif //USE_OS_SELF_TEST
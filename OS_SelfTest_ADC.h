@@ -0,0 +1,81 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_ADC.h
+\brief      Non-intrusive cyclic ADC test in free slots of the application's
+            conversion sequence.
+*           The test converts the reference channels of SELFTEST_ADC_REFERENCES
+*           one after the other. It doesn't start conversions itself: The ADC
+*           driver of the application asks with OS_SelfTest_ADC_GetSlotRequest()
+*           for a channel when its sequence has a free slot and hands the result
+*           over with OS_SelfTest_ADC_SlotResult(), also from its ISR. The test
+*           only polls, so it never waits for the ADC and never disturbs the
+*           regular conversions.
+*           A result outside of the tolerance window of its reference fails the
+*           test. A conversion which isn't done within SELFTEST_ADC_SLOT_TIMEOUT
+*           fails it as well, so an application which never offers a free slot
+*           can't stall the sequence unnoticed.
+***********************************************************************************/
+#ifndef SELFTEST_ADC_H
+#define SELFTEST_ADC_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Modes of the cyclic ADC test
+#define SELFTEST_ADC_MODE_DIRECT        (0u)    // eSelfTest_S_ADC(), adds own conversions
+#define SELFTEST_ADC_MODE_SLOT          (1u)    // Reference conversions in free slots of the application
+
+#ifndef SELFTEST_ADC_MODE
+    #define SELFTEST_ADC_MODE           SELFTEST_ADC_MODE_DIRECT
+#endif
+
+// Reference channels: Initializer of { channel, expected value, tolerance }
+#if ( SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT ) && !defined(SELFTEST_ADC_REFERENCES)
+    #error "SELFTEST_ADC_MODE_SLOT needs the reference channels SELFTEST_ADC_REFERENCES"
+#endif
+
+#define SELFTEST_ADC_REFERENCE_COUNT    (sizeof((tsSelfTest_AdcReference[])SELFTEST_ADC_REFERENCES) / sizeof(tsSelfTest_AdcReference))
+
+// Ticks from the request of a conversion to its result
+#ifndef SELFTEST_ADC_SLOT_TIMEOUT
+    #define SELFTEST_ADC_SLOT_TIMEOUT   0u
+#endif
+#if ( SELFTEST_ADC_MODE == SELFTEST_ADC_MODE_SLOT ) && ( SELFTEST_ADC_SLOT_TIMEOUT == 0u )
+    #error "SELFTEST_ADC_MODE_SLOT needs the conversion timeout SELFTEST_ADC_SLOT_TIMEOUT"
+#endif
+
+//*** Reference channel of the slot test *****
+typedef struct
+{
+    u8 ucChannel;                       // ADC channel of the reference
+    u16 usExpected;                     // Expected conversion result
+    u16 usTolerance;                    // Allowed deviation in both directions
+} tsSelfTest_AdcReference;
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void OS_SelfTest_ADC_Start(void);
+u8 OS_SelfTest_ADC_Poll(void);
+bool OS_SelfTest_ADC_GetSlotRequest(u8* pucChannel);
+void OS_SelfTest_ADC_SlotResult(u8 ucChannel, u16 usValue);
+u32 OS_SelfTest_ADC_GetReferenceCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_ADC_H
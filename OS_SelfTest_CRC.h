@@ -0,0 +1,99 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_CRC.h
+\brief      CRC engine for the cyclic flash test.
+            The engine is selected at build time with SELFTEST_CRC_ENGINE.
+*           All engines calculate the same CRC-32 (IEEE 802.3, reflected polynomial
+*           0xEDB88320) as the post-link reference read with SelfTest_FlashCRCRead().
+*           The CRC is continued from the given start value and is NOT inverted
+*           at the end, so a complete image is checked against ~ulCrc.
+*           With SELFTEST_CRC_ASYNC a job is started with OS_SelfTest_CRC_Start()
+*           on a DMA or hardware CRC engine ( HAL_SelfTest_CRC_Start/Poll ) and
+*           only polled with OS_SelfTest_CRC_Poll() on the following calls.
+*           Without it the job is calculated in OS_SelfTest_CRC_Start() and the
+*           first poll returns the result, so the caller has one code path.
+*           OS_SelfTest_CRC_CalcPoly() calculates further polynomials in software
+*           with 16 entry nibble tables, e.g. for the regions of the flash test.
+***********************************************************************************/
+#ifndef SELFTEST_CRC_H
+#define SELFTEST_CRC_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Available CRC engines
+#define SELFTEST_CRC_ENGINE_BITWISE     (0u)    // Bit by bit, no table. Smallest, slowest
+#define SELFTEST_CRC_ENGINE_TABLE       (1u)    // One 256 entry table (1kB), byte by byte
+#define SELFTEST_CRC_ENGINE_SLICE4      (2u)    // Four 256 entry tables (4kB), 32bit word reads
+#define SELFTEST_CRC_ENGINE_SLICE8      (3u)    // Eight 256 entry tables (8kB), 2x32bit word reads
+#define SELFTEST_CRC_ENGINE_HW          (4u)    // Hardware CRC unit via HAL_SelfTest_CRC_Calc()
+
+// Engine used when the project configuration doesn't select one
+#ifndef SELFTEST_CRC_ENGINE
+    #define SELFTEST_CRC_ENGINE         SELFTEST_CRC_ENGINE_SLICE8
+#endif
+
+#if ( SELFTEST_CRC_ENGINE > SELFTEST_CRC_ENGINE_HW )
+    #error "SELFTEST_CRC_ENGINE: unknown CRC engine selected"
+#endif
+
+// The slicing engines read 32bit words, their tables need the little endian byte order.
+// Taken from the compiler, set SELFTEST_CRC_LITTLE_ENDIAN when it doesn't tell.
+#ifndef SELFTEST_CRC_LITTLE_ENDIAN
+    #if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+        #define SELFTEST_CRC_LITTLE_ENDIAN  true
+    #else
+        #define SELFTEST_CRC_LITTLE_ENDIAN  false
+    #endif
+#endif
+
+#if ( SELFTEST_CRC_ENGINE == SELFTEST_CRC_ENGINE_SLICE4 ) || ( SELFTEST_CRC_ENGINE == SELFTEST_CRC_ENGINE_SLICE8 )
+    #if ( SELFTEST_CRC_LITTLE_ENDIAN != true )
+        #error "SELFTEST_CRC_ENGINE: the slicing engines need a little endian target, set SELFTEST_CRC_LITTLE_ENDIAN or select SELFTEST_CRC_ENGINE_TABLE"
+    #elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+        #error "SELFTEST_CRC_LITTLE_ENDIAN: the compiler builds for a big endian target"
+    #endif
+#endif
+
+// Polynomials of OS_SelfTest_CRC_CalcPoly(). All are reflected, the CRC starts
+// with CRC_INIT_VALUE cut to its width and is compared inverted.
+#define SELFTEST_CRC_POLY_CRC32         (0u)    // CRC-32 IEEE 802.3 with SELFTEST_CRC_ENGINE
+#define SELFTEST_CRC_POLY_CRC32C        (1u)    // CRC-32C Castagnoli 0x82F63B78
+#define SELFTEST_CRC_POLY_CRC16         (2u)    // CRC-16 CCITT 0x8408 ( X.25 )
+#define SELFTEST_CRC_POLY_COUNT         (3u)
+
+#define SELFTEST_CRC_POLY_MASK(ucPoly)  (((ucPoly) == SELFTEST_CRC_POLY_CRC16) ? 0xFFFFu : 0xFFFFFFFFu)
+
+// Background CRC jobs on a DMA or hardware CRC engine
+#ifndef SELFTEST_CRC_ASYNC
+    #define SELFTEST_CRC_ASYNC          false
+#endif
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+u32 OS_SelfTest_CRC_Calc(const u8* pucData, u32 ulLength, u32 ulCrc);
+u32 OS_SelfTest_CRC_CalcPoly(u8 ucPolynomial, const u8* pucData, u32 ulLength, u32 ulCrc);
+u32 OS_SelfTest_CRC_GetBytesPerTick(void);
+void OS_SelfTest_CRC_ResetThroughput(void);
+u8 OS_SelfTest_CRC_Start(const u8* pucData, u32 ulLength, u32 ulCrc);
+u8 OS_SelfTest_CRC_Poll(u32* pulCrc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_CRC_H
@@ -0,0 +1,159 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_ECC
+\details    ECC scrub of the SRAM. See OS_SelfTest_ECC.h
+*/
+
+#include "OS_SelfTest_ECC.h"
+
+#ifdef USE_OS_SELF_TEST
+
+#include "OS_SelfTest.h"
+#include "OS_SelfTest_March.h"
+#include "HAL_SelfTest_ECC.h"
+
+/****************************************** Variables ****************************************************/
+#if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+static tsSelfTest_EccCounters sSfT_EccLast;         // Counters after the last tile
+static bool bSfT_EccStarted = false;
+static tsSelfTest_EccStatus sSfT_EccStatus;
+#endif
+
+
+/****************************************** local functions *********************************************/
+#if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reads the words of a tile. Four reads per loop, so the loop
+            overhead doesn't limit the bus bandwidth.
+\return     none
+\param      pWord - First word
+\param      ulWords - Number of words
+**********************************************************************************/
+static void ReadWords(const volatile SELFTEST_ECC_WORD* pWord, u32 ulWords)
+{
+    SELFTEST_ECC_WORD Sink = 0u;
+
+    while(ulWords >= 4u)
+    {
+        Sink ^= SELFTEST_ECC_READ(&pWord[0]);
+        Sink ^= SELFTEST_ECC_READ(&pWord[1]);
+        Sink ^= SELFTEST_ECC_READ(&pWord[2]);
+        Sink ^= SELFTEST_ECC_READ(&pWord[3]);
+        pWord += 4u;
+        ulWords -= 4u;
+    }
+    while(ulWords--)
+    {
+        Sink ^= SELFTEST_ECC_READ(pWord);
+        pWord++;
+    }
+    (void)Sink;                             // Only the reads count, the ECC logic checks them
+}
+#endif
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      ECC scrub of one SRAM tile. Same interface as SelfTest_March_SRAM().
+            Bytes behind the last complete word are not read.
+\return     PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS for the last tile
+            or ERROR_STATUS on an uncorrectable error or too many corrected
+            errors in this pass
+\param      ulStartAdr - First address of the tile, word aligned
+\param      ulSize - Size of the tile in bytes
+\param      ulEndAdr - Last address of the tested area
+***********************************************************************************/
+u8 OS_SelfTest_ECC_Scrub(u32 ulStartAdr, u32 ulSize, u32 ulEndAdr)
+{
+    u8 ucResult = PASS_STILL_TESTING_STATUS;
+
+    #if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+    tsSelfTest_EccStatus* psStatus = &sSfT_EccStatus;
+    tsSelfTest_EccCounters sNow;
+
+    if(bSfT_EccStarted == false)
+    {
+        HAL_SelfTest_ECC_GetCounters(&sSfT_EccLast);
+        bSfT_EccStarted = true;
+    }
+
+    /* Last tile ends at the end address */
+    if((ulStartAdr + ulSize) > ulEndAdr)
+    {
+        ulSize = (ulEndAdr + 1u) - ulStartAdr;
+        ucResult = PASS_COMPLETE_STATUS;
+    }
+    ReadWords((const volatile SELFTEST_ECC_WORD*)SELFTEST_SRAM_PTR(ulStartAdr), ulSize / sizeof(SELFTEST_ECC_WORD));
+
+    HAL_SelfTest_ECC_GetCounters(&sNow);
+    if((sNow.ulCorrected != sSfT_EccLast.ulCorrected) || (sNow.ulUncorrected != sSfT_EccLast.ulUncorrected))
+    {
+        psStatus->ulCorrected += sNow.ulCorrected - sSfT_EccLast.ulCorrected;
+        psStatus->ulPassCorrected += sNow.ulCorrected - sSfT_EccLast.ulCorrected;
+        psStatus->ulUncorrected += sNow.ulUncorrected - sSfT_EccLast.ulUncorrected;
+        psStatus->ulAddress = sNow.ulAddress;
+        psStatus->ulSyndrome = sNow.ulSyndrome;
+
+        if(sNow.ulUncorrected != sSfT_EccLast.ulUncorrected)
+        {
+            ucResult = ERROR_STATUS;
+        }
+        #if SELFTEST_ECC_CORRECTED_LIMIT > 0u
+        else if(psStatus->ulPassCorrected > SELFTEST_ECC_CORRECTED_LIMIT)
+        {
+            ucResult = ERROR_STATUS;
+        }
+        #endif
+        sSfT_EccLast = sNow;
+    }
+
+    if(ucResult != PASS_STILL_TESTING_STATUS)
+    {
+        psStatus->ulLastPassCorrected = psStatus->ulPassCorrected;
+        psStatus->ulPassCorrected = 0u;
+        if(ucResult == PASS_COMPLETE_STATUS)
+        {
+            psStatus->ulPasses++;
+        }
+    }
+    #else
+    (void)ulStartAdr;
+    (void)ulSize;
+    (void)ulEndAdr;
+    #endif
+
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the state of the ECC scrub
+\return     none
+\param      psStatus - Receives the state
+***********************************************************************************/
+void OS_SelfTest_ECC_GetStatus(tsSelfTest_EccStatus* psStatus)
+{
+    #if SELFTEST_RAM_MODE == SELFTEST_RAM_MODE_ECC_SCRUB
+    if(psStatus)
+    {
+        *psStatus = sSfT_EccStatus;
+    }
+    #else
+    (void)psStatus;
+    #endif
+}
+
+#endif //USE_OS_SELF_TEST
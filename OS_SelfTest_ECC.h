@@ -0,0 +1,89 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_ECC.h
+\brief      ECC scrub of the SRAM for parts with hardware ECC.
+            With SELFTEST_RAM_MODE_ECC_SCRUB the cyclic SRAM test only reads
+*           TEST_SRAM_STARTADR..TEST_SRAM_ENDADR, word by word at the bus bandwidth.
+*           The ECC logic checks each read word, so a pass reaches every cell without
+*           writing it: No save buffer, no interrupt lock and bigger tiles than the
+*           March test. Each tile compares the error counters of the ECC logic
+*           before and after the tile:
+*           - An uncorrectable error fails the test
+*           - Corrected errors are counted, with SELFTEST_ECC_CORRECTED_LIMIT the
+*             test fails when a pass has more of them
+*           Address and syndrome of the last error are kept for the diagnosis.
+*           The counters are free running, errors found by accesses of the
+*           application between two tiles are counted as well.
+*           The HAL captures the errors, on most parts in the fault handler of the
+*           uncorrectable error.
+***********************************************************************************/
+#ifndef SELFTEST_ECC_H
+#define SELFTEST_ECC_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Width of one ECC protected word of the SRAM
+#ifndef SELFTEST_ECC_WORD
+    #define SELFTEST_ECC_WORD               u32
+#endif
+#ifndef SELFTEST_ECC_TILE_SIZE
+    #define SELFTEST_ECC_TILE_SIZE          (TEST_BLOCK_SRAM_SIZE * 16u)    // Bytes per call
+#endif
+#ifndef SELFTEST_ECC_TILE_MIN_SIZE
+    #define SELFTEST_ECC_TILE_MIN_SIZE      (TEST_BLOCK_SRAM_SIZE)          // Smallest tile of the budgeted run
+#endif
+#ifndef SELFTEST_ECC_CORRECTED_LIMIT
+    #define SELFTEST_ECC_CORRECTED_LIMIT    (0u)        // Corrected errors per pass, 0 = not checked
+#endif
+
+// Read access of a word. Can be replaced for a simulated ECC memory
+#ifndef SELFTEST_ECC_READ
+    #define SELFTEST_ECC_READ(pWord)        (*(pWord))
+#endif
+
+//*** Free running counters of the ECC logic *****
+typedef struct
+{
+    u32 ulCorrected;                    // Corrected single bit errors
+    u32 ulUncorrected;                  // Uncorrectable errors
+    u32 ulAddress;                      // Address of the last error
+    u32 ulSyndrome;                     // Syndrome of the last error
+} tsSelfTest_EccCounters;
+
+//*** State of the ECC scrub *****
+typedef struct
+{
+    u32 ulPasses;                       // Completed passes
+    u32 ulCorrected;                    // Corrected errors since start
+    u32 ulUncorrected;                  // Uncorrectable errors since start
+    u32 ulPassCorrected;                // Corrected errors of the running pass
+    u32 ulLastPassCorrected;            // Corrected errors of the last complete pass
+    u32 ulAddress;                      // Address of the last error
+    u32 ulSyndrome;                     // Syndrome of the last error
+} tsSelfTest_EccStatus;
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+u8 OS_SelfTest_ECC_Scrub(u32 ulStartAdr, u32 ulSize, u32 ulEndAdr);
+void OS_SelfTest_ECC_GetStatus(tsSelfTest_EccStatus* psStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_ECC_H
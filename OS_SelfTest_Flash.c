@@ -0,0 +1,583 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_Flash
+\details    Tile based flash test with a post-link manifest. See OS_SelfTest_Flash.h
+*/
+
+#include "OS_SelfTest_Flash.h"
+
+#ifdef USE_OS_SELF_TEST
+
+#include "OS_SelfTest.h"
+#include "OS_SelfTest_CRC.h"
+
+#include <stddef.h>
+
+/****************************************** Defines ******************************************************/
+#define MANIFEST_HEADER_WORDS   (5u)    // Words in front of the tile CRCs
+
+
+/****************************************** Variables ****************************************************/
+// Application image, set by the linker
+extern u32 ulAppCodeLength;
+extern u32 ulAppCodeStart;
+
+// Streaming engine of the region table
+#if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+static tsSelfTest_FlashRegion asSfT_Region[SELFTEST_FLASH_REGION_COUNT];   // Built from SELFTEST_FLASH_REGIONS
+static bool bSfT_RegionTable = false;
+static tsSelfTest_FlashRegionStatus sSfT_RegionStatus[SELFTEST_FLASH_REGION_COUNT];
+static u32 ulSfT_RegionCrc[SELFTEST_FLASH_REGION_COUNT];       // CRC of the running check
+static u32 ulSfT_RegionRelease[SELFTEST_FLASH_REGION_COUNT];   // Time tick the next check is due
+static u32 ulSfT_RegionNext = 0u;                               // Next region in turn
+static bool bSfT_RegionsStarted = false;
+static u32 ulSfT_RegionPassSize = 0u;                           // Bytes of the regions of the running pass
+static u32 ulSfT_RegionPassDone = 0u;                           // Checked bytes of the running pass
+#if SELFTEST_CRC_ASYNC == true
+static u32 ulSfT_RegionJob = SELFTEST_FLASH_REGION_COUNT;       // Region of the running CRC job, none
+static u32 ulSfT_RegionJobSize = 0u;
+#endif
+#endif
+
+
+/****************************************** Function prototypes ******************************************/
+
+extern u32 OS_SW_Timer_GetSystemTickCount( void );
+
+
+/****************************************** local functions *********************************************/
+#if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Entry of the region table. The initializer may use values known only
+            at link or run time, so the table is built once on the first access
+            and again by OS_SelfTest_Flash_InitRegions().
+\return     The region
+\param      ulRegion - Index of the region
+**********************************************************************************/
+static const tsSelfTest_FlashRegion* GetRegion(u32 ulRegion)
+{
+    if(bSfT_RegionTable == false)
+    {
+        const tsSelfTest_FlashRegion asRegion[SELFTEST_FLASH_REGION_COUNT] = SELFTEST_FLASH_REGIONS;
+        u32 ulIdx;
+
+        for(ulIdx = 0u; ulIdx < SELFTEST_FLASH_REGION_COUNT; ulIdx++)
+        {
+            asSfT_Region[ulIdx] = asRegion[ulIdx];
+        }
+        bSfT_RegionTable = true;
+    }
+    return &asSfT_Region[ulRegion];
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Adds a checked tile to the running check of a region. The last
+            tile compares the CRC with the reference of the region.
+\return     PASS_STILL_TESTING_STATUS or ERROR_STATUS
+\param      ulRegion - Index of the region
+\param      ulCrc - Continued CRC including the tile
+\param      ulSize - Bytes of the tile
+**********************************************************************************/
+static u8 AddRegionTile(u32 ulRegion, u32 ulCrc, u32 ulSize)
+{
+    const tsSelfTest_FlashRegion* psRegion = GetRegion(ulRegion);
+    tsSelfTest_FlashRegionStatus* psStatus = &sSfT_RegionStatus[ulRegion];
+    u8 ucResult = PASS_STILL_TESTING_STATUS;
+
+    ulSfT_RegionCrc[ulRegion] = ulCrc;
+    psStatus->ulOffset += ulSize;
+    ulSfT_RegionPassDone += ulSize;
+
+    if(psStatus->ulOffset >= psRegion->ulLength)
+    {
+        u32 ulReference = *(const u32*)SELFTEST_FLASH_PTR(psRegion->ulReferenceAdr);
+
+        if(ulReference != (~ulCrc & SELFTEST_CRC_POLY_MASK(psRegion->ucPolynomial)))
+        {
+            ucResult = ERROR_STATUS;
+        }
+        psStatus->ulChecks++;
+        psStatus->ulLastCheck = OS_SW_Timer_GetSystemTickCount();
+        psStatus->bActive = false;
+    }
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Next region of the running pass in turn, without moving on
+\return     Index of the region, SELFTEST_FLASH_REGION_COUNT when all are done
+\param      none
+**********************************************************************************/
+static u32 PeekRegion(void)
+{
+    u32 ulRegion = SELFTEST_FLASH_REGION_COUNT;
+    u32 ulIdx;
+
+    for(ulIdx = 0u; ulIdx < SELFTEST_FLASH_REGION_COUNT; ulIdx++)
+    {
+        u32 ulCandidate = (ulSfT_RegionNext + ulIdx) % SELFTEST_FLASH_REGION_COUNT;
+
+        if(sSfT_RegionStatus[ulCandidate].bActive)
+        {
+            ulRegion = ulCandidate;
+            break;
+        }
+    }
+    return ulRegion;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Next region of the running pass in turn
+\return     Index of the region, SELFTEST_FLASH_REGION_COUNT when all are done
+\param      none
+**********************************************************************************/
+static u32 NextRegion(void)
+{
+    u32 ulRegion = PeekRegion();
+
+    if(ulRegion < SELFTEST_FLASH_REGION_COUNT)
+    {
+        ulSfT_RegionNext = ulRegion + 1u;
+    }
+    return ulRegion;
+}
+#endif
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reads and validates the manifest at SELFTEST_FLASH_MANIFEST_ADR.
+            The manifest must describe the actual application image and its
+            own CRC must match.
+\return     The manifest, NULL when it is missing, corrupted or doesn't match
+            the application image
+\param      none
+***********************************************************************************/
+const tsSelfTest_FlashManifest* OS_SelfTest_Flash_GetManifest(void)
+{
+    const tsSelfTest_FlashManifest* psManifest = NULL;
+
+    #if ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_MANIFEST )
+    {
+        const tsSelfTest_FlashManifest* psRead = (const tsSelfTest_FlashManifest*)SELFTEST_FLASH_PTR(SELFTEST_FLASH_MANIFEST_ADR);
+
+        if((psRead->ulSignature == SELFTEST_MANIFEST_SIGNATURE)
+        && (psRead->ulStartAdr == ulAppCodeStart)
+        && (psRead->ulLength == ulAppCodeLength)
+        && (psRead->ulTileSize != 0u)
+        && (psRead->ulTileCount == ((psRead->ulLength + psRead->ulTileSize - 1u) / psRead->ulTileSize)))
+        {
+            u32 ulSize = (MANIFEST_HEADER_WORDS + psRead->ulTileCount) * sizeof(u32);
+            u32 ulCrc = OS_SelfTest_CRC_Calc((const u8*)psRead, ulSize, CRC_INIT_VALUE);
+
+            if(psRead->aulTileCrc[psRead->ulTileCount] == ~ulCrc)
+            {
+                psManifest = psRead;
+            }
+        }
+    }
+    #endif
+
+    return psManifest;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts the CRC job of one tile, see OS_SelfTest_CRC_Start()
+\return     PASS_STILL_TESTING_STATUS when started, ERROR_STATUS for a tile
+            outside of the image or an engine fault
+\param      psManifest - Validated manifest from OS_SelfTest_Flash_GetManifest()
+\param      ulTile - Index of the tile
+***********************************************************************************/
+u8 OS_SelfTest_Flash_StartTile(const tsSelfTest_FlashManifest* psManifest, u32 ulTile)
+{
+    u8 ucResult = ERROR_STATUS;
+
+    if(psManifest && (ulTile < psManifest->ulTileCount))
+    {
+        u32 ulOffset = ulTile * psManifest->ulTileSize;
+        u32 ulSize = psManifest->ulLength - ulOffset;
+
+        if(ulSize > psManifest->ulTileSize)
+        {
+            ulSize = psManifest->ulTileSize;
+        }
+
+        if(OS_SelfTest_CRC_Start(SELFTEST_FLASH_PTR(psManifest->ulStartAdr + ulOffset), ulSize, CRC_INIT_VALUE) == OK_STATUS)
+        {
+            ucResult = PASS_STILL_TESTING_STATUS;
+        }
+    }
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Polls the CRC job of a tile started with OS_SelfTest_Flash_StartTile()
+            and compares the result with the manifest
+\return     PASS_STILL_TESTING_STATUS while the job runs, OK_STATUS or ERROR_STATUS
+\param      psManifest - Validated manifest from OS_SelfTest_Flash_GetManifest()
+\param      ulTile - Index of the started tile
+***********************************************************************************/
+u8 OS_SelfTest_Flash_PollTile(const tsSelfTest_FlashManifest* psManifest, u32 ulTile)
+{
+    u32 ulCrc = 0u;
+    u8 ucResult = OS_SelfTest_CRC_Poll(&ulCrc);
+
+    if(ucResult == PASS_COMPLETE_STATUS)
+    {
+        ucResult = (psManifest->aulTileCrc[ulTile] == ~ulCrc) ? OK_STATUS : ERROR_STATUS;
+    }
+    else if(ucResult != PASS_STILL_TESTING_STATUS)
+    {
+        ucResult = ERROR_STATUS;
+    }
+    else
+    {
+        // Job still running
+    }
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks one tile and waits for the result
+\return     OK_STATUS or ERROR_STATUS, also for a tile outside of the image
+\param      psManifest - Validated manifest from OS_SelfTest_Flash_GetManifest()
+\param      ulTile - Index of the tile
+***********************************************************************************/
+u8 OS_SelfTest_Flash_CheckTile(const tsSelfTest_FlashManifest* psManifest, u32 ulTile)
+{
+    u8 ucResult = OS_SelfTest_Flash_StartTile(psManifest, ulTile);
+
+    while(ucResult == PASS_STILL_TESTING_STATUS)
+    {
+        ucResult = OS_SelfTest_Flash_PollTile(psManifest, ulTile);
+    }
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Drops the running checks of the regions, e.g. on a restart of the
+            cyclic sequence. All regions are due again with the next pass.
+            The counts of completed checks are kept.
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_Flash_InitRegions(void)
+{
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    u32 ulRegion;
+
+    for(ulRegion = 0u; ulRegion < SELFTEST_FLASH_REGION_COUNT; ulRegion++)
+    {
+        sSfT_RegionStatus[ulRegion].bActive = false;
+        sSfT_RegionStatus[ulRegion].ulOffset = 0u;
+    }
+    ulSfT_RegionNext = 0u;
+    bSfT_RegionTable = false;                       // Take changed link or run time values
+    bSfT_RegionsStarted = false;
+    ulSfT_RegionPassSize = 0u;
+    ulSfT_RegionPassDone = 0u;
+    #if SELFTEST_CRC_ASYNC == true
+    ulSfT_RegionJob = SELFTEST_FLASH_REGION_COUNT;  // A result of the dropped job is ignored
+    #endif
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts a pass over the region table: Each region whose period
+            has elapsed is added to the pass. The period counts from the
+            start of a check. A region which gets due during the pass waits
+            for the next one, so the pass stays bounded by the sum of the
+            region lengths.
+\return     Number of regions checked in this pass
+\param      none
+***********************************************************************************/
+u32 OS_SelfTest_Flash_StartRegions(void)
+{
+    u32 ulActive = 0u;
+
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    u32 ulNow = OS_SW_Timer_GetSystemTickCount();
+    u32 ulRegion;
+
+    ulSfT_RegionPassSize = 0u;
+    ulSfT_RegionPassDone = 0u;
+    for(ulRegion = 0u; ulRegion < SELFTEST_FLASH_REGION_COUNT; ulRegion++)
+    {
+        const tsSelfTest_FlashRegion* psRegion = GetRegion(ulRegion);
+        tsSelfTest_FlashRegionStatus* psStatus = &sSfT_RegionStatus[ulRegion];
+
+        if(bSfT_RegionsStarted == false)
+        {
+            ulSfT_RegionRelease[ulRegion] = ulNow;      // All regions are due with the first pass
+        }
+
+        if((psStatus->bActive == false) && (psRegion->ulLength != 0u) && ((s32)(ulNow - ulSfT_RegionRelease[ulRegion]) >= 0))
+        {
+            psStatus->bActive = true;
+            psStatus->ulOffset = 0u;
+            ulSfT_RegionCrc[ulRegion] = CRC_INIT_VALUE & SELFTEST_CRC_POLY_MASK(psRegion->ucPolynomial);
+
+            ulSfT_RegionRelease[ulRegion] += psRegion->ulPeriod;
+            if((psRegion->ulPeriod == 0u) || ((s32)(ulNow - ulSfT_RegionRelease[ulRegion]) > 0))
+            {
+                ulSfT_RegionRelease[ulRegion] = ulNow;
+            }
+        }
+
+        if(psStatus->bActive)
+        {
+            ulSfT_RegionPassSize += psRegion->ulLength - psStatus->ulOffset;
+            ulActive++;
+        }
+    }
+    bSfT_RegionsStarted = true;
+    #endif
+
+    return ulActive;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Checks the next tile of the regions of the running pass, one
+            region after the other. With SELFTEST_CRC_ASYNC the CRC-32 tiles
+            run in the background and the next call polls for the result,
+            the tiles of the other polynomials are calculated at once.
+\return     PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS when all regions
+            of the pass are checked or ERROR_STATUS on a CRC mismatch or an
+            engine fault
+\param      ulTileSize - Bytes per tile
+\param      pulBytes - Receives the bytes of the tile started or calculated
+***********************************************************************************/
+u8 OS_SelfTest_Flash_StreamRegions(u32 ulTileSize, u32* pulBytes)
+{
+    u8 ucResult = PASS_STILL_TESTING_STATUS;
+    u32 ulBytes = 0u;
+
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    bool bEngineFree = true;
+
+    #if SELFTEST_CRC_ASYNC == true
+    if(ulSfT_RegionJob < SELFTEST_FLASH_REGION_COUNT)
+    {
+        u32 ulCrc = 0u;
+        u8 ucStatus = OS_SelfTest_CRC_Poll(&ulCrc);
+
+        if(ucStatus == PASS_COMPLETE_STATUS)
+        {
+            ucResult = AddRegionTile(ulSfT_RegionJob, ulCrc, ulSfT_RegionJobSize);
+            ulSfT_RegionJob = SELFTEST_FLASH_REGION_COUNT;
+        }
+        else if(ucStatus == PASS_STILL_TESTING_STATUS)
+        {
+            bEngineFree = false;                    // Tile still running in the background
+        }
+        else
+        {
+            ucResult = ERROR_STATUS;
+        }
+    }
+    #endif
+
+    if((ucResult == PASS_STILL_TESTING_STATUS) && bEngineFree)
+    {
+        u32 ulRegion = NextRegion();
+
+        if(ulRegion >= SELFTEST_FLASH_REGION_COUNT)
+        {
+            ucResult = PASS_COMPLETE_STATUS;
+        }
+        else
+        {
+            const tsSelfTest_FlashRegion* psRegion = GetRegion(ulRegion);
+            u32 ulOffset = sSfT_RegionStatus[ulRegion].ulOffset;
+            const u8* pucTile = SELFTEST_FLASH_PTR(psRegion->ulStartAdr + ulOffset);
+
+            ulBytes = psRegion->ulLength - ulOffset;
+            if(ulBytes > ulTileSize)
+            {
+                ulBytes = ulTileSize;
+            }
+
+            #if SELFTEST_CRC_ASYNC == true
+            if(psRegion->ucPolynomial == SELFTEST_CRC_POLY_CRC32)
+            {
+                if(OS_SelfTest_CRC_Start(pucTile, ulBytes, ulSfT_RegionCrc[ulRegion]) == OK_STATUS)
+                {
+                    ulSfT_RegionJob = ulRegion;
+                    ulSfT_RegionJobSize = ulBytes;
+                }
+                else
+                {
+                    ucResult = ERROR_STATUS;
+                }
+            }
+            else
+            #endif
+            {
+                u32 ulCrc = OS_SelfTest_CRC_CalcPoly(psRegion->ucPolynomial, pucTile, ulBytes, ulSfT_RegionCrc[ulRegion]);
+                ucResult = AddRegionTile(ulRegion, ulCrc, ulBytes);
+            }
+        }
+    }
+    #else
+    (void)ulTileSize;
+    #endif
+
+    *pulBytes = ulBytes;
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Polynomial of the region whose tile is checked next. The polynomials
+            differ much in speed, so the caller sizes the tile per polynomial.
+\return     SELFTEST_CRC_POLY_xxx, SELFTEST_CRC_POLY_CRC32 when no region is left
+            or without SELFTEST_FLASH_MODE_REGIONS
+\param      none
+***********************************************************************************/
+u8 OS_SelfTest_Flash_GetNextPolynomial(void)
+{
+    u8 ucPolynomial = SELFTEST_CRC_POLY_CRC32;
+
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    u32 ulRegion = PeekRegion();
+
+    if(ulRegion < SELFTEST_FLASH_REGION_COUNT)
+    {
+        ucPolynomial = GetRegion(ulRegion)->ucPolynomial;
+    }
+    #endif
+
+    return ucPolynomial;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Sum of the lengths of all regions, the bytes of a pass in which
+            all regions are due
+\return     Bytes, 0 without SELFTEST_FLASH_MODE_REGIONS
+\param      none
+***********************************************************************************/
+u32 OS_SelfTest_Flash_GetRegionBytes(void)
+{
+    u32 ulBytes = 0u;
+
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    u32 ulRegion;
+
+    for(ulRegion = 0u; ulRegion < SELFTEST_FLASH_REGION_COUNT; ulRegion++)
+    {
+        ulBytes += GetRegion(ulRegion)->ulLength;
+    }
+    #endif
+
+    return ulBytes;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Progress of the running pass over the region table. Only the
+            regions due in this pass are counted.
+\return     Checked bytes of the running pass, 0 without SELFTEST_FLASH_MODE_REGIONS
+\param      pulSize - Receives the bytes of the running pass, may be NULL
+***********************************************************************************/
+u32 OS_SelfTest_Flash_GetRegionProgress(u32* pulSize)
+{
+    u32 ulDone = 0u;
+    u32 ulSize = 0u;
+
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    ulDone = ulSfT_RegionPassDone;
+    ulSize = ulSfT_RegionPassSize;
+    #endif
+
+    if(pulSize)
+    {
+        *pulSize = ulSize;
+    }
+    return ulDone;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the state of a region
+\return     false for an unknown region or without SELFTEST_FLASH_MODE_REGIONS
+\param      ulRegion - Index into SELFTEST_FLASH_REGIONS
+\param      psStatus - Receives the state
+***********************************************************************************/
+bool OS_SelfTest_Flash_GetRegionStatus(u32 ulRegion, tsSelfTest_FlashRegionStatus* psStatus)
+{
+    bool bValid = false;
+
+    #if SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS
+    if(psStatus && (ulRegion < SELFTEST_FLASH_REGION_COUNT))
+    {
+        *psStatus = sSfT_RegionStatus[ulRegion];
+        bValid = true;
+    }
+    #else
+    (void)ulRegion;
+    (void)psStatus;
+    #endif
+
+    return bValid;
+}
+
+#endif //USE_OS_SELF_TEST
@@ -0,0 +1,124 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_Flash.h
+\brief      Tile based flash test with a post-link generated manifest.
+            The manifest holds one CRC-32 per tile of the application image
+*           (see Tools/SelfTest_FlashManifest.py). Each tile is checked as soon
+*           as it is read, so a corrupted byte is reported after one tile instead
+*           of one pass. Tiles can be checked in any order.
+*           The manifest is placed at SELFTEST_FLASH_MANIFEST_ADR, outside of the
+*           image it describes, and is protected by its own CRC.
+*
+*           With SELFTEST_FLASH_MODE_REGIONS the flash is described by the region
+*           table SELFTEST_FLASH_REGIONS ( e.g. bootloader, application, calibration
+*           data, constant tables ). Each region has its own reference CRC in flash,
+*           polynomial and check period. The regions due at the start of a pass are
+*           checked tile by tile in turn by one streaming engine, so a small hot region
+*           isn't delayed behind a big cold one. A region with a period is checked
+*           again in the first pass after its period, the others in each pass.
+*           Regions only join a pass at its start. A region which gets due during
+*           a pass waits for the next one, so its check starts up to one pass later
+*           than its period.
+***********************************************************************************/
+#ifndef SELFTEST_FLASH_H
+#define SELFTEST_FLASH_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Modes of the cyclic flash test
+#define SELFTEST_FLASH_MODE_IMAGE       (0u)    // One CRC over the image, reference from SelfTest_FlashCRCRead()
+#define SELFTEST_FLASH_MODE_MANIFEST    (1u)    // One CRC per tile, reference from the manifest
+#define SELFTEST_FLASH_MODE_REGIONS     (2u)    // Region table with own references, polynomials and periods
+
+#ifndef SELFTEST_FLASH_MODE
+    #define SELFTEST_FLASH_MODE         SELFTEST_FLASH_MODE_IMAGE
+#endif
+
+#if ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_MANIFEST ) && !defined(SELFTEST_FLASH_MANIFEST_ADR)
+    #error "SELFTEST_FLASH_MODE_MANIFEST needs the address SELFTEST_FLASH_MANIFEST_ADR"
+#endif
+
+// The region table may use values known only at link or run time, so its size
+// SELFTEST_FLASH_REGION_COUNT is given along with it
+#if ( SELFTEST_FLASH_MODE == SELFTEST_FLASH_MODE_REGIONS ) && ( !defined(SELFTEST_FLASH_REGIONS) || !defined(SELFTEST_FLASH_REGION_COUNT) )
+    #error "SELFTEST_FLASH_MODE_REGIONS needs the region table SELFTEST_FLASH_REGIONS and SELFTEST_FLASH_REGION_COUNT"
+#endif
+#ifndef SELFTEST_FLASH_REGION_COUNT
+    #define SELFTEST_FLASH_REGION_COUNT (0u)
+#endif
+
+// Converts a flash address into a pointer. Can be replaced for simulated memories
+#ifndef SELFTEST_FLASH_PTR
+    #define SELFTEST_FLASH_PTR(ulAdr)   ((const u8*)(ulAdr))
+#endif
+
+#define SELFTEST_MANIFEST_SIGNATURE     (0x464D5453u)   // "STMF"
+
+/****************************** type definitions *****************************/
+//*** Flash manifest, generated after linking *****
+// The tile CRCs are followed by the CRC of the manifest ( signature up to the
+// last tile CRC ). All CRCs are CRC-32 IEEE 802.3 from CRC_INIT_VALUE, inverted.
+typedef struct
+{
+    u32 ulSignature;                    // SELFTEST_MANIFEST_SIGNATURE
+    u32 ulStartAdr;                     // First address of the image
+    u32 ulLength;                       // Length of the image in bytes
+    u32 ulTileSize;                     // Bytes per tile, the last tile may be shorter
+    u32 ulTileCount;                    // Number of tiles
+    u32 aulTileCrc[];                   // CRC of each tile
+} tsSelfTest_FlashManifest;
+
+//*** Region of SELFTEST_FLASH_REGIONS *****
+typedef struct
+{
+    u32 ulStartAdr;                     // First address of the region
+    u32 ulLength;                       // Length in bytes
+    u32 ulReferenceAdr;                 // Flash address of the reference CRC ( u32, inverted )
+    u32 ulPeriod;                       // Ticks from the start of one check to the next, 0 = each pass.
+                                        // Rounded up to the next start of a pass
+    u8 ucPolynomial;                    // SELFTEST_CRC_POLY_xxx
+} tsSelfTest_FlashRegion;
+
+//*** State of a region *****
+typedef struct
+{
+    u32 ulChecks;                       // Completed checks
+    u32 ulLastCheck;                    // Time tick of the last completed check
+    u32 ulOffset;                       // Checked bytes of the running check
+    bool bActive;                       // Checked in the running pass
+} tsSelfTest_FlashRegionStatus;
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+const tsSelfTest_FlashManifest* OS_SelfTest_Flash_GetManifest(void);
+u8 OS_SelfTest_Flash_CheckTile(const tsSelfTest_FlashManifest* psManifest, u32 ulTile);
+u8 OS_SelfTest_Flash_StartTile(const tsSelfTest_FlashManifest* psManifest, u32 ulTile);
+u8 OS_SelfTest_Flash_PollTile(const tsSelfTest_FlashManifest* psManifest, u32 ulTile);
+void OS_SelfTest_Flash_InitRegions(void);
+u32 OS_SelfTest_Flash_StartRegions(void);
+u8 OS_SelfTest_Flash_StreamRegions(u32 ulTileSize, u32* pulBytes);
+u8 OS_SelfTest_Flash_GetNextPolynomial(void);
+u32 OS_SelfTest_Flash_GetRegionBytes(void);
+u32 OS_SelfTest_Flash_GetRegionProgress(u32* pulSize);
+bool OS_SelfTest_Flash_GetRegionStatus(u32 ulRegion, tsSelfTest_FlashRegionStatus* psStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_FLASH_H
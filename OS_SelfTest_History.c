@@ -0,0 +1,147 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_History
+\details    History of the cyclic self-test results. See OS_SelfTest_History.h
+*/
+
+#include "OS_SelfTest_History.h"
+
+#ifdef USE_OS_SELF_TEST
+
+/****************************************** Defines ******************************************************/
+#define HISTORY_MASK            (SELFTEST_HISTORY_SIZE - 1u)
+
+//*** Slot of the ring buffer *****
+typedef struct
+{
+    u32 ulSequence;                     // Odd while the record is written
+    tsSelfTest_Record sRecord;
+} tsSelfTest_HistorySlot;
+
+
+/****************************************** Variables ****************************************************/
+static volatile tsSelfTest_HistorySlot sSfT_History[SELFTEST_HISTORY_SIZE];
+static volatile u32 ulSfT_HistoryCount = 0u;   // Number of written records, the next record number
+
+
+/****************************************** Function prototypes ******************************************/
+
+extern u32 OS_SW_Timer_GetSystemTickCount( void );
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Appends a record to the history. Called only by the cyclic runner,
+            wait-free.
+\return     none
+\param      eTestID - The test
+\param      eResultCode - eSelfTest_OK or eSelfTest_ERROR
+\param      ulDuration - Execution time of all steps of the test
+\param      ulTile - Number of steps, on error the failed one
+***********************************************************************************/
+void OS_SelfTest_History_Write(teSelfTest_ID eTestID, teSelfTest_ResultCode eResultCode, u32 ulDuration, u32 ulTile)
+{
+    const u32 ulNumber = ulSfT_HistoryCount;
+    volatile tsSelfTest_HistorySlot* psSlot = &sSfT_History[ulNumber & HISTORY_MASK];
+    const u32 ulSequence = psSlot->ulSequence;
+
+    psSlot->ulSequence = ulSequence + 1u;       // Odd: Slot is written
+    SELFTEST_MEMORY_BARRIER();
+
+    psSlot->sRecord.ulNumber = ulNumber;
+    psSlot->sRecord.ulTimestamp = OS_SW_Timer_GetSystemTickCount();
+    psSlot->sRecord.ulDuration = ulDuration;
+    psSlot->sRecord.ulTile = ulTile;
+    psSlot->sRecord.eTestID = eTestID;
+    psSlot->sRecord.eResultCode = eResultCode;
+
+    SELFTEST_MEMORY_BARRIER();
+    psSlot->ulSequence = ulSequence + 2u;       // Even: Slot is consistent
+    SELFTEST_MEMORY_BARRIER();
+    ulSfT_HistoryCount = ulNumber + 1u;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Reads a consistent copy of a record. Doesn't lock the interrupts,
+            can be called from any task or ISR. When the record is already
+            overwritten, the oldest available one is read instead, so a reader
+            lapped by the writer skips ahead. The skipped records are the gap
+            between the requested number and psRecord->ulNumber.
+\return     false when the record isn't written yet or the writer was
+            interrupted while writing its slot
+\param      pulNumber - Number of the record, set to the number following
+            the read record
+\param      psRecord - Receives the record
+***********************************************************************************/
+bool OS_SelfTest_History_Read(u32* pulNumber, tsSelfTest_Record* psRecord)
+{
+    bool bValid = false;
+    u8 ucRetry;
+
+    for(ucRetry = 0u; pulNumber && psRecord && (ucRetry < SELFTEST_HISTORY_READ_RETRIES) && (bValid == false); ucRetry++)
+    {
+        const u32 ulCount = ulSfT_HistoryCount;
+        const u32 ulAge = ulCount - *pulNumber;         // 0 = next record, not written yet
+        const u32 ulNumber = (ulAge > SELFTEST_HISTORY_SIZE) ? (ulCount - SELFTEST_HISTORY_SIZE) : *pulNumber;
+        volatile const tsSelfTest_HistorySlot* psSlot = &sSfT_History[ulNumber & HISTORY_MASK];
+
+        if((ulAge == 0u) || (ulAge >= 0x80000000u))
+        {
+            break;                                      // Not written yet or ahead of the writer
+        }
+        else
+        {
+            const u32 ulSequence = psSlot->ulSequence;
+
+            if((ulSequence & 1u) == 0u)
+            {
+                SELFTEST_MEMORY_BARRIER();
+                psRecord->ulNumber = psSlot->sRecord.ulNumber;
+                psRecord->ulTimestamp = psSlot->sRecord.ulTimestamp;
+                psRecord->ulDuration = psSlot->sRecord.ulDuration;
+                psRecord->ulTile = psSlot->sRecord.ulTile;
+                psRecord->eTestID = psSlot->sRecord.eTestID;
+                psRecord->eResultCode = psSlot->sRecord.eResultCode;
+                SELFTEST_MEMORY_BARRIER();
+
+                if((psSlot->ulSequence == ulSequence) && (psRecord->ulNumber == ulNumber))
+                {
+                    *pulNumber = ulNumber + 1u;
+                    bValid = true;
+                }
+                else
+                {
+                    // Overwritten while read, retry with the oldest record then
+                }
+            }
+        }
+    }
+    return bValid;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Returns the number of written records. The newest record has the
+            number count - 1, the oldest available one count - SELFTEST_HISTORY_SIZE.
+\return     Number of written records
+\param      none
+***********************************************************************************/
+u32 OS_SelfTest_History_GetCount(void)
+{
+    return ulSfT_HistoryCount;
+}
+
+#endif //USE_OS_SELF_TEST
@@ -0,0 +1,80 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_History.h
+\brief      History of the cyclic self-test results.
+            Ring buffer of SELFTEST_HISTORY_SIZE timestamped records with one
+*           writer, the cyclic runner, and any number of readers ( diagnostic task,
+*           ISR, debugger ). The writer never waits. Each slot is protected by a
+*           sequence counter which is odd while the slot is written, so a reader
+*           detects a torn record and retries without locking the interrupts.
+*           Records are numbered from 0, the reader follows the history with its
+*           own record number, which each read moves on:
+*               while(OS_SelfTest_History_Read(&ulNext, &sRecord)) { ... }
+*           Records older than SELFTEST_HISTORY_SIZE are overwritten. A reader
+*           lapped by the writer gets the oldest available record instead, the
+*           records it missed are the gap to sRecord.ulNumber.
+***********************************************************************************/
+#ifndef SELFTEST_HISTORY_H
+#define SELFTEST_HISTORY_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "OS_SelfTest.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Number of records, power of two
+#ifndef SELFTEST_HISTORY_SIZE
+    #define SELFTEST_HISTORY_SIZE       (16u)
+#endif
+
+#if ( SELFTEST_HISTORY_SIZE == 0u ) || ( ( SELFTEST_HISTORY_SIZE & ( SELFTEST_HISTORY_SIZE - 1u ) ) != 0u )
+    #error "SELFTEST_HISTORY_SIZE has to be a power of two"
+#endif
+
+// Reads of a slot before the reader gives up. A reader interrupting the writer
+// would wait forever for the slot, so the retries are limited.
+#ifndef SELFTEST_HISTORY_READ_RETRIES
+    #define SELFTEST_HISTORY_READ_RETRIES   (3u)
+#endif
+
+// Orders the accesses to the slot. A compiler barrier is enough on a single core,
+// a multi core or host reader needs a hardware fence ( e.g. __DMB() ).
+#ifndef SELFTEST_MEMORY_BARRIER
+    #define SELFTEST_MEMORY_BARRIER()   __asm volatile ("" ::: "memory")
+#endif
+
+//*** Result record of a test *****
+typedef struct
+{
+    u32 ulNumber;                       // Running number of the record
+    u32 ulTimestamp;                    // System tick of the result
+    u32 ulDuration;                     // Execution time of all steps, SELFTEST_GET_TIME() units
+    u32 ulTile;                         // Number of steps ( tiles ), on error the failed one
+    teSelfTest_ID eTestID;              // The test
+    teSelfTest_ResultCode eResultCode;  // eSelfTest_OK or eSelfTest_ERROR
+} tsSelfTest_Record;
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void OS_SelfTest_History_Write(teSelfTest_ID eTestID, teSelfTest_ResultCode eResultCode, u32 ulDuration, u32 ulTile);
+bool OS_SelfTest_History_Read(u32* pulNumber, tsSelfTest_Record* psRecord);
+u32 OS_SelfTest_History_GetCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_HISTORY_H
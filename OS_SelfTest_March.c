@@ -0,0 +1,192 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_March
+\details    Transparent word-wide March test. See OS_SelfTest_March.h
+*/
+
+#include "OS_SelfTest_March.h"
+
+#ifdef USE_OS_SELF_TEST
+
+#include "OS_SelfTest.h"
+
+/****************************************** Defines ******************************************************/
+// Cells are accessed volatile, so each element really reads and writes the memory
+#define MARCH_CELL                  volatile SELFTEST_MARCH_WORD
+
+//*** Signature of the reads of one element *****
+typedef struct
+{
+    SELFTEST_MARCH_WORD Sum;            // Sum of the read words
+    SELFTEST_MARCH_WORD Xor;            // XOR of the read words
+} tsSelfTest_MarchSig;
+
+
+/****************************************** local functions *********************************************/
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      March element with ascending addresses: Reads each word and
+            writes it back inverted
+\return     Signature of the read words
+\param      pCell - First word of the tile
+\param      ulWords - Number of words
+**********************************************************************************/
+static tsSelfTest_MarchSig MarchUp(MARCH_CELL* pCell, u32 ulWords)
+{
+    tsSelfTest_MarchSig sSig = { 0u, 0u };
+    u32 ulIdx;
+
+    for(ulIdx = 0u; ulIdx < ulWords; ulIdx++)
+    {
+        SELFTEST_MARCH_WORD Word = SELFTEST_MARCH_READ(&pCell[ulIdx]);
+
+        sSig.Sum += Word;
+        sSig.Xor ^= Word;
+        pCell[ulIdx] = ~Word;
+    }
+    return sSig;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      March element with descending addresses: Reads each word and
+            writes it back inverted
+\return     Signature of the read words
+\param      pCell - First word of the tile
+\param      ulWords - Number of words
+**********************************************************************************/
+static tsSelfTest_MarchSig MarchDown(MARCH_CELL* pCell, u32 ulWords)
+{
+    tsSelfTest_MarchSig sSig = { 0u, 0u };
+    u32 ulIdx;
+
+    for(ulIdx = ulWords; ulIdx-- > 0u; )
+    {
+        SELFTEST_MARCH_WORD Word = SELFTEST_MARCH_READ(&pCell[ulIdx]);
+
+        sSig.Sum += Word;
+        sSig.Xor ^= Word;
+        pCell[ulIdx] = ~Word;
+    }
+    return sSig;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Final read-only element
+\return     Signature of the read words
+\param      pCell - First word of the tile
+\param      ulWords - Number of words
+**********************************************************************************/
+static tsSelfTest_MarchSig MarchRead(MARCH_CELL* pCell, u32 ulWords)
+{
+    tsSelfTest_MarchSig sSig = { 0u, 0u };
+    u32 ulIdx;
+
+    for(ulIdx = 0u; ulIdx < ulWords; ulIdx++)
+    {
+        SELFTEST_MARCH_WORD Word = SELFTEST_MARCH_READ(&pCell[ulIdx]);
+
+        sSig.Sum += Word;
+        sSig.Xor ^= Word;
+    }
+    return sSig;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Compares the signature of an element with the expected one
+\return     true when equal
+\param      psSig - Signature of the element
+\param      psExpected - Expected signature
+**********************************************************************************/
+static bool MarchSigEqual(const tsSelfTest_MarchSig* psSig, const tsSelfTest_MarchSig* psExpected)
+{
+    return (psSig->Sum == psExpected->Sum) && (psSig->Xor == psExpected->Xor);
+}
+
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Transparent March test of one SRAM tile. Same interface as
+            SelfTest_March_SRAM(). The first element reads the content c,
+            the signature of the inverted content is predicted from it:
+            sum(~c) = -n - sum(c), xor(~c) = xor(c) inverted for odd n.
+            Each following element is checked against c or ~c.
+            Bytes behind the last complete word are not tested.
+\return     PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS for the last tile
+            or ERROR_STATUS
+\param      ulStartAdr - First address of the tile, word aligned
+\param      ulSize - Size of the tile in bytes
+\param      ulEndAdr - Last address of the tested area
+***********************************************************************************/
+u8 OS_SelfTest_March_Transparent(u32 ulStartAdr, u32 ulSize, u32 ulEndAdr)
+{
+    u8 ucResult = PASS_STILL_TESTING_STATUS;
+    MARCH_CELL* pCell = (MARCH_CELL*)SELFTEST_SRAM_PTR(ulStartAdr);
+    tsSelfTest_MarchSig sContent;
+    tsSelfTest_MarchSig sInverted;
+    tsSelfTest_MarchSig sSig;
+    bool bPass;
+    u32 ulWords;
+
+    /* Last tile ends at the end address */
+    if((ulStartAdr + ulSize) > ulEndAdr)
+    {
+        ulSize = (ulEndAdr + 1u) - ulStartAdr;
+        ucResult = PASS_COMPLETE_STATUS;
+    }
+    ulWords = ulSize / sizeof(SELFTEST_MARCH_WORD);
+
+    /* up(r c, w ~c): Defines the content */
+    sContent = MarchUp(pCell, ulWords);
+    sInverted.Sum = (SELFTEST_MARCH_WORD)0u - (SELFTEST_MARCH_WORD)ulWords - sContent.Sum;
+    sInverted.Xor = (ulWords & 1u) ? (SELFTEST_MARCH_WORD)~sContent.Xor : sContent.Xor;
+
+    #if SELFTEST_MARCH_ALGORITHM == SELFTEST_MARCH_C_MINUS
+        /* up(r ~c, w c) */
+        sSig = MarchUp(pCell, ulWords);
+        bPass = MarchSigEqual(&sSig, &sInverted);
+
+        /* down(r c, w ~c) */
+        sSig = MarchDown(pCell, ulWords);
+        bPass = bPass && MarchSigEqual(&sSig, &sContent);
+    #else
+        bPass = true;
+    #endif
+
+    /* down(r ~c, w c) */
+    sSig = MarchDown(pCell, ulWords);
+    bPass = bPass && MarchSigEqual(&sSig, &sInverted);
+
+    /* (r c) */
+    sSig = MarchRead(pCell, ulWords);
+    bPass = bPass && MarchSigEqual(&sSig, &sContent);
+
+    if(bPass == false)
+    {
+        ucResult = ERROR_STATUS;
+    }
+    return ucResult;
+}
+
+#endif //USE_OS_SELF_TEST
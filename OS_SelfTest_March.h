@@ -0,0 +1,75 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_March.h
+\brief      Transparent word-wide March test of the SRAM in portable C.
+            The cells keep their content: Instead of 0 and 1 patterns each word
+*           is written with its inverted content and restored by the next element.
+*           The reads of each element are checked against a sum and a XOR signature
+*           predicted from the first element, so no save buffer is needed.
+*           Transparent March C-: up(r c,w ~c); up(r ~c,w c); down(r c,w ~c);
+*                                 down(r ~c,w c); (r c)
+*           Transparent March X:  up(r c,w ~c); down(r ~c,w c); (r c)
+*           The tile has to be tested with locked interrupts and must not contain
+*           the active stack.
+***********************************************************************************/
+#ifndef SELFTEST_MARCH_H
+#define SELFTEST_MARCH_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Modes of the cyclic SRAM test
+#define SELFTEST_RAM_MODE_MARCH         (0u)    // SelfTest_March_SRAM() with save buffer
+#define SELFTEST_RAM_MODE_TRANSPARENT   (1u)    // OS_SelfTest_March_Transparent(), no save buffer
+#define SELFTEST_RAM_MODE_ECC_SCRUB     (2u)    // OS_SelfTest_ECC_Scrub(), read only for SRAM with hardware ECC
+
+#ifndef SELFTEST_RAM_MODE
+    #define SELFTEST_RAM_MODE           SELFTEST_RAM_MODE_MARCH
+#endif
+
+// Algorithms of the transparent test
+#define SELFTEST_MARCH_C_MINUS          (0u)    // 10n, detects also coupling faults of both directions
+#define SELFTEST_MARCH_X                (1u)    // 6n, stuck-at, transition and address faults
+
+#ifndef SELFTEST_MARCH_ALGORITHM
+    #define SELFTEST_MARCH_ALGORITHM    SELFTEST_MARCH_C_MINUS
+#endif
+
+// Word width of the test, the native bus width of the target
+#ifndef SELFTEST_MARCH_WORD
+    #define SELFTEST_MARCH_WORD         u32
+#endif
+
+// Read access of a cell. Can be replaced to simulate faulty cells
+#ifndef SELFTEST_MARCH_READ
+    #define SELFTEST_MARCH_READ(pCell)  (*(pCell))
+#endif
+
+// Converts an SRAM address into a pointer. Can be replaced for simulated memories
+#ifndef SELFTEST_SRAM_PTR
+    #define SELFTEST_SRAM_PTR(ulAdr)    ((void*)(ulAdr))
+#endif
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+u8 OS_SelfTest_March_Transparent(u32 ulStartAdr, u32 ulSize, u32 ulEndAdr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_MARCH_H
@@ -0,0 +1,152 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_Stack
+\details    High-water mark of the stack. See OS_SelfTest_Stack.h
+*/
+
+#include "OS_SelfTest_Stack.h"
+
+#ifdef USE_OS_SELF_TEST
+
+#include "OS_SelfTest.h"
+
+/****************************************** Variables ****************************************************/
+#if SELFTEST_STACK_WATERMARK == true
+static u32 ulSfT_StackMark = 0u;            // Lowest overwritten word found
+static u32 ulSfT_StackScanAdr = 0u;         // Next word of the running scan
+static u32 ulSfT_StackScans = 0u;
+static bool bSfT_StackFilled = false;
+#endif
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Fills the unused stack with the fill pattern. Must be called with
+            locked interrupts, an interrupt would use the filled area.
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_Stack_Fill(void)
+{
+    #if SELFTEST_STACK_WATERMARK == true
+    u32 ulFillEnd = (SELFTEST_STACK_POINTER() - SELFTEST_STACK_FILL_MARGIN) & ~(sizeof(u32) - 1u);
+    u32 ulAdr;
+
+    if(ulFillEnd > (SELFTEST_STACK_ENDADR + 1u))
+    {
+        ulFillEnd = SELFTEST_STACK_ENDADR + 1u;
+    }
+
+    for(ulAdr = SELFTEST_STACK_STARTADR; ulAdr < ulFillEnd; ulAdr += sizeof(u32))
+    {
+        *SELFTEST_STACK_PTR(ulAdr) = SELFTEST_STACK_FILL_PATTERN;
+    }
+
+    /* Everything above the filled area counts as used */
+    ulSfT_StackMark = ulFillEnd;
+    ulSfT_StackScanAdr = SELFTEST_STACK_STARTADR;
+    ulSfT_StackScans = 0u;
+    bSfT_StackFilled = true;
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Scans the next SELFTEST_STACK_SCAN_WORDS words of the unused stack
+            for the fill pattern, upwards from SELFTEST_STACK_STARTADR to the
+            high-water mark. An overwritten word ends the scan and is the new
+            high-water mark.
+\return     PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS at the end of a scan
+            or ERROR_STATUS when less than SELFTEST_STACK_MIN_FREE bytes are free
+\param      none
+***********************************************************************************/
+u8 OS_SelfTest_Stack_Scan(void)
+{
+    u8 ucResult = PASS_COMPLETE_STATUS;
+
+    #if SELFTEST_STACK_WATERMARK == true
+    if(bSfT_StackFilled)
+    {
+        u32 ulAdr = ulSfT_StackScanAdr;
+        u32 ulEnd = ulAdr + (SELFTEST_STACK_SCAN_WORDS * sizeof(u32));
+
+        if(ulEnd > ulSfT_StackMark)
+        {
+            ulEnd = ulSfT_StackMark;
+        }
+
+        while((ulAdr < ulEnd) && (*SELFTEST_STACK_PTR(ulAdr) == SELFTEST_STACK_FILL_PATTERN))
+        {
+            ulAdr += sizeof(u32);
+        }
+
+        if(ulAdr < ulEnd)
+        {
+            ulSfT_StackMark = ulAdr;                // Overwritten, the stack grew
+        }
+        else if(ulAdr < ulSfT_StackMark)
+        {
+            ucResult = PASS_STILL_TESTING_STATUS;   // Continue with the next call
+        }
+
+        if(ucResult == PASS_STILL_TESTING_STATUS)
+        {
+            ulSfT_StackScanAdr = ulAdr;
+        }
+        else
+        {
+            ulSfT_StackScanAdr = SELFTEST_STACK_STARTADR;
+            ulSfT_StackScans++;
+
+            #if SELFTEST_STACK_MIN_FREE > 0u
+            if((ulSfT_StackMark - SELFTEST_STACK_STARTADR) < SELFTEST_STACK_MIN_FREE)
+            {
+                ucResult = ERROR_STATUS;
+            }
+            #endif
+        }
+    }
+    #endif
+
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Stack usage at the high-water mark of the last scans
+\return     false without SELFTEST_STACK_WATERMARK or before the fill
+\param      psUsage - Receives the usage
+***********************************************************************************/
+bool OS_SelfTest_Stack_GetUsage(tsSelfTest_StackUsage* psUsage)
+{
+    bool bValid = false;
+
+    #if SELFTEST_STACK_WATERMARK == true
+    if(psUsage && bSfT_StackFilled)
+    {
+        psUsage->ulSize = (SELFTEST_STACK_ENDADR + 1u) - SELFTEST_STACK_STARTADR;
+        psUsage->ulUsed = (SELFTEST_STACK_ENDADR + 1u) - ulSfT_StackMark;
+        psUsage->ulFree = ulSfT_StackMark - SELFTEST_STACK_STARTADR;
+        psUsage->ulScans = ulSfT_StackScans;
+        bValid = true;
+    }
+    #else
+    (void)psUsage;
+    #endif
+
+    return bValid;
+}
+
+#endif //USE_OS_SELF_TEST
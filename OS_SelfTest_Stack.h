@@ -0,0 +1,92 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_Stack.h
+\brief      High-water mark of the stack for the cyclic stack test.
+            OS_SelfTest_Stack_Fill() writes SELFTEST_STACK_FILL_PATTERN into the
+*           unused stack from SELFTEST_STACK_STARTADR up to the actual stack pointer
+*           ( less SELFTEST_STACK_FILL_MARGIN ). It runs in the startup after the
+*           memory initialization, before the interrupts are enabled.
+*           OS_SelfTest_Stack_Scan() searches upwards from SELFTEST_STACK_STARTADR for
+*           the lowest overwritten word, SELFTEST_STACK_SCAN_WORDS words per call.
+*           The stack grows downwards, so the scan ends at the last known high-water
+*           mark and the used part of the stack is never read again. A scan ends with
+*           the first overwritten word, this is the new high-water mark.
+*           Each scan reads the whole unused stack again and takes up to
+*           1 + free bytes / ( 4 * SELFTEST_STACK_SCAN_WORDS ) calls. A scan downwards
+*           from the mark would be cheaper, but it stops at the first unchanged word
+*           and misses a deeper frame whose top words stay unwritten, e.g. a local
+*           buffer which isn't filled completely.
+*           With SELFTEST_STACK_MIN_FREE the scan fails when less bytes stay unused.
+*           The guard words below SELFTEST_STACK_STARTADR are checked by the HAL.
+***********************************************************************************/
+#ifndef SELFTEST_STACK_H
+#define SELFTEST_STACK_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+#ifndef SELFTEST_STACK_WATERMARK
+    #define SELFTEST_STACK_WATERMARK        false
+#endif
+
+#if SELFTEST_STACK_WATERMARK == true
+    #if !defined(SELFTEST_STACK_STARTADR) || !defined(SELFTEST_STACK_ENDADR)
+        #error "SELFTEST_STACK_WATERMARK needs SELFTEST_STACK_STARTADR and SELFTEST_STACK_ENDADR"
+    #endif
+#endif
+
+#ifndef SELFTEST_STACK_FILL_PATTERN
+    #define SELFTEST_STACK_FILL_PATTERN     0xCDCDCDCDu
+#endif
+#ifndef SELFTEST_STACK_FILL_MARGIN
+    #define SELFTEST_STACK_FILL_MARGIN      (64u)       // Bytes below the stack pointer
+#endif
+#ifndef SELFTEST_STACK_SCAN_WORDS
+    #define SELFTEST_STACK_SCAN_WORDS       (32u)       // Words per call
+#endif
+#ifndef SELFTEST_STACK_MIN_FREE
+    #define SELFTEST_STACK_MIN_FREE         (0u)        // Bytes, 0 = not checked
+#endif
+
+// Actual stack pointer and the mapping of a stack address. Can be replaced for a simulated stack
+#ifndef SELFTEST_STACK_POINTER
+    #define SELFTEST_STACK_POINTER()        ((u32)__builtin_frame_address(0u))
+#endif
+#ifndef SELFTEST_STACK_PTR
+    #define SELFTEST_STACK_PTR(ulAdr)       ((volatile u32*)(ulAdr))
+#endif
+
+//*** Stack usage at the high-water mark *****
+typedef struct
+{
+    u32 ulSize;                         // Bytes from SELFTEST_STACK_STARTADR to SELFTEST_STACK_ENDADR
+    u32 ulUsed;                         // Bytes above the high-water mark
+    u32 ulFree;                         // Bytes never used since the fill
+    u32 ulScans;                        // Completed scans
+} tsSelfTest_StackUsage;
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void OS_SelfTest_Stack_Fill(void);
+u8 OS_SelfTest_Stack_Scan(void);
+bool OS_SelfTest_Stack_GetUsage(tsSelfTest_StackUsage* psUsage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_STACK_H
@@ -0,0 +1,49 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_Time
+\details    Time stamp source of the self-test timing. See OS_SelfTest_Time.h
+*/
+
+#include "OS_SelfTest_Time.h"
+
+#ifdef USE_OS_SELF_TEST
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Starts the time stamp source. The cycle counter of the DWT runs
+            only with the trace enabled. Called first in the startup, the
+            startup tests are measured already.
+\return     none
+\param      none
+***********************************************************************************/
+void OS_SelfTest_Time_Init(void)
+{
+    #if SELFTEST_TIME_SOURCE == SELFTEST_TIME_SOURCE_DWT
+        SELFTEST_DEMCR |= SELFTEST_DEMCR_TRCENA;
+        SELFTEST_DWT_LAR = SELFTEST_DWT_LAR_KEY;
+        SELFTEST_DWT_CYCCNT = 0u;
+        SELFTEST_DWT_CTRL |= SELFTEST_DWT_CTRL_CYCCNTENA;
+    #endif
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Converts a time in SELFTEST_GET_TIME() units
+\return     Time in us
+\param      ulTime - Difference of two time stamps
+***********************************************************************************/
+u32 OS_SelfTest_Time_ToUs(u32 ulTime)
+{
+    return (u32)(((u64)ulTime * 1000000u) / (u64)SELFTEST_TIME_HZ);
+}
+
+#endif //USE_OS_SELF_TEST
@@ -0,0 +1,93 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_Time.h
+\brief      Time stamp source of the self-test timing.
+            SELFTEST_GET_TIME() is used for the time budgets, the tile adaption
+*           and the profiling of the steps. The system tick of the OS has only
+*           millisecond resolution, most steps take some microseconds. So the
+*           time stamp can come from:
+*           SELFTEST_TIME_SOURCE_TICK: OS_SW_Timer_GetSystemTickCount(), 1ms
+*           SELFTEST_TIME_SOURCE_DWT:  Cycle counter DWT_CYCCNT of a Cortex-M3/M4/M7/M33,
+*                                      enabled by OS_SelfTest_Time_Init()
+*           SELFTEST_TIME_SOURCE_HOOK: SELFTEST_GET_TIME() of SelfTest_Config.h,
+*                                      e.g. rdtsc or clock_gettime() on a host
+*           SELFTEST_TIME_HZ gives the time stamps per second.
+*
+*           With SELFTEST_PROFILING false the profiling is compiled out: The step
+*           and interrupt lock statistics and the durations in the history aren't
+*           measured. The time budgets and the tile adaption still use the time stamp.
+***********************************************************************************/
+#ifndef SELFTEST_TIME_H
+#define SELFTEST_TIME_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+#define SELFTEST_TIME_SOURCE_TICK       (0u)
+#define SELFTEST_TIME_SOURCE_DWT        (1u)
+#define SELFTEST_TIME_SOURCE_HOOK       (2u)
+#ifndef SELFTEST_TIME_SOURCE
+    #ifdef SELFTEST_GET_TIME
+        #define SELFTEST_TIME_SOURCE    SELFTEST_TIME_SOURCE_HOOK
+    #else
+        #define SELFTEST_TIME_SOURCE    SELFTEST_TIME_SOURCE_TICK
+    #endif
+#endif
+
+#ifndef SELFTEST_PROFILING
+    #define SELFTEST_PROFILING          true
+#endif
+
+#if SELFTEST_TIME_SOURCE == SELFTEST_TIME_SOURCE_TICK
+    #define SELFTEST_GET_TIME()         OS_SW_Timer_GetSystemTickCount()
+    #ifndef SELFTEST_TIME_HZ
+        #define SELFTEST_TIME_HZ        (1000u)             // 1ms system tick
+    #endif
+
+#elif SELFTEST_TIME_SOURCE == SELFTEST_TIME_SOURCE_DWT
+    // Debug exception and monitor control, data watchpoint and trace unit
+    #define SELFTEST_DEMCR              (*(volatile u32*)0xE000EDFCu)
+    #define SELFTEST_DEMCR_TRCENA       (1u << 24u)
+    #define SELFTEST_DWT_CTRL           (*(volatile u32*)0xE0001000u)
+    #define SELFTEST_DWT_CTRL_CYCCNTENA (1u << 0u)
+    #define SELFTEST_DWT_CYCCNT         (*(volatile u32*)0xE0001004u)
+    #define SELFTEST_DWT_LAR            (*(volatile u32*)0xE0001FB0u)   // Lock access of the Cortex-M7
+    #define SELFTEST_DWT_LAR_KEY        (0xC5ACCE55u)
+
+    #define SELFTEST_GET_TIME()         SELFTEST_DWT_CYCCNT
+    #ifndef SELFTEST_TIME_HZ
+        #error "SELFTEST_TIME_SOURCE_DWT needs the core clock SELFTEST_TIME_HZ"
+    #endif
+
+#elif SELFTEST_TIME_SOURCE == SELFTEST_TIME_SOURCE_HOOK
+    #if !defined(SELFTEST_GET_TIME) || !defined(SELFTEST_TIME_HZ)
+        #error "SELFTEST_TIME_SOURCE_HOOK needs SELFTEST_GET_TIME() and SELFTEST_TIME_HZ"
+    #endif
+#endif
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+u32 OS_SW_Timer_GetSystemTickCount(void);   // OS software timer
+
+void OS_SelfTest_Time_Init(void);
+u32 OS_SelfTest_Time_ToUs(u32 ulTime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_TIME_H
@@ -0,0 +1,137 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_UART
+\details    Passive UART test from the driver counters. See OS_SelfTest_UART.h
+*/
+
+#include "OS_SelfTest_UART.h"
+
+#ifdef USE_OS_SELF_TEST
+
+#include "OS_SelfTest.h"
+#include "HAL_SelfTest_UART.h"
+
+/****************************************** Variables ****************************************************/
+#if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+static tsSelfTest_UartCounters sSfT_UartLast;       // Counters of the last check
+static u32 ulSfT_UartCrcFrames = 0u;                // Frames at the last CRC judgement
+static u32 ulSfT_UartCrcErrors = 0u;                // CRC errors at the last CRC judgement
+static bool bSfT_UartStarted = false;
+static tsSelfTest_UartStatus sSfT_UartStatus;
+#endif
+
+
+/****************************************** Function prototypes ******************************************/
+
+extern u32 OS_SW_Timer_GetSystemTickCount( void );
+
+
+/****************************************** External visible functions **********************************/
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Judges the UART from the driver counters since the last check.
+            The first check only takes the counters.
+\return     OK_STATUS or ERROR_STATUS
+\param      none
+***********************************************************************************/
+u8 OS_SelfTest_UART_Check(void)
+{
+    u8 ucResult = OK_STATUS;
+
+    #if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+    tsSelfTest_UartCounters sNow;
+    u32 ulNow = OS_SW_Timer_GetSystemTickCount();
+
+    HAL_SelfTest_UART_GetCounters(&sNow);
+
+    if(bSfT_UartStarted == false)
+    {
+        ulSfT_UartCrcFrames = sNow.ulRxFrames;
+        ulSfT_UartCrcErrors = sNow.ulCrcErrors;
+        sSfT_UartStatus.ulLastTraffic = ulNow;
+        sSfT_UartStatus.ulCrcPermille = 1000u;
+        bSfT_UartStarted = true;
+    }
+    else
+    {
+        u32 ulLineErrors = (sNow.ulFramingErrors - sSfT_UartLast.ulFramingErrors)
+                         + (sNow.ulParityErrors - sSfT_UartLast.ulParityErrors)
+                         + (sNow.ulOverrunErrors - sSfT_UartLast.ulOverrunErrors);
+        u32 ulCrcFrames = sNow.ulRxFrames - ulSfT_UartCrcFrames;
+
+        sSfT_UartStatus.ulLineErrors += ulLineErrors;
+        if(ulLineErrors > SELFTEST_UART_MAX_LINE_ERRORS)
+        {
+            ucResult = ERROR_STATUS;
+        }
+
+        /* CRC pass ratio over at least SELFTEST_UART_MIN_FRAMES frames */
+        if(ulCrcFrames >= SELFTEST_UART_MIN_FRAMES)
+        {
+            u32 ulCrcErrors = sNow.ulCrcErrors - ulSfT_UartCrcErrors;
+
+            sSfT_UartStatus.ulCrcPermille = (ulCrcErrors >= ulCrcFrames) ? 0u
+                                          : (u32)(((u64)(ulCrcFrames - ulCrcErrors) * 1000u) / ulCrcFrames);
+            if(sSfT_UartStatus.ulCrcPermille < SELFTEST_UART_MIN_CRC_PERMILLE)
+            {
+                ucResult = ERROR_STATUS;
+            }
+            ulSfT_UartCrcFrames = sNow.ulRxFrames;
+            ulSfT_UartCrcErrors = sNow.ulCrcErrors;
+        }
+
+        /* Traffic within the timeout, else loopback in a quiet window */
+        if(sNow.ulRxFrames != sSfT_UartLast.ulRxFrames)
+        {
+            sSfT_UartStatus.ulLastTraffic = ulNow;
+        }
+        else if((ulNow - sSfT_UartStatus.ulLastTraffic) > SELFTEST_UART_TRAFFIC_TIMEOUT)
+        {
+            #if SELFTEST_UART_LOOPBACK_FALLBACK == true
+            if(HAL_SelfTest_UART_IsQuiet())
+            {
+                sSfT_UartStatus.ulLoopbacks++;
+                sSfT_UartStatus.ulLastTraffic = ulNow;
+                if(HAL_SelfTest_UART_Check())
+                {
+                    ucResult = ERROR_STATUS;
+                }
+            }
+            #else
+            ucResult = ERROR_STATUS;
+            #endif
+        }
+    }
+    sSfT_UartLast = sNow;
+    #endif
+
+    return ucResult;
+}
+
+
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+\brief      Copies the state of the passive UART test
+\return     none
+\param      psStatus - Receives the state
+***********************************************************************************/
+void OS_SelfTest_UART_GetStatus(tsSelfTest_UartStatus* psStatus)
+{
+    #if SELFTEST_UART_MODE == SELFTEST_UART_MODE_PASSIVE
+    if(psStatus)
+    {
+        *psStatus = sSfT_UartStatus;
+    }
+    #else
+    (void)psStatus;
+    #endif
+}
+
+#endif //USE_OS_SELF_TEST
@@ -0,0 +1,87 @@
+//********************************************************************************
+/*!
+\author     Kraemer E.
+\date       16.10.2026
+
+\file       OS_SelfTest_UART.h
+\brief      Passive cyclic UART test from the counters of the UART driver.
+            The live traffic is judged instead of sending test characters:
+*           - Framing, parity and overrun errors since the last check
+*             ( at most SELFTEST_UART_MAX_LINE_ERRORS )
+*           - CRC pass ratio of the received frames, judged every
+*             SELFTEST_UART_MIN_FRAMES frames ( at least SELFTEST_UART_MIN_CRC_PERMILLE )
+*           - Traffic within SELFTEST_UART_TRAFFIC_TIMEOUT ticks
+*           Without traffic the active loopback test HAL_SelfTest_UART_Check()
+*           runs as fallback, but only when the driver reports a quiet bus.
+*           No fallback with SELFTEST_UART_LOOPBACK_FALLBACK false, the missing
+*           traffic fails the test then.
+***********************************************************************************/
+#ifndef SELFTEST_UART_H
+#define SELFTEST_UART_H
+
+
+#include "OS_Config.h"
+#ifdef USE_OS_SELF_TEST
+/********************************* includes **********************************/
+
+#include "BaseTypes.h"
+#include "SelfTest_Config.h"
+/***************************** defines / macros ******************************/
+// Modes of the cyclic UART test
+#define SELFTEST_UART_MODE_LOOPBACK         (0u)    // HAL_SelfTest_UART_Check(), sends on the bus
+#define SELFTEST_UART_MODE_PASSIVE          (1u)    // Driver counters of the live traffic
+
+#ifndef SELFTEST_UART_MODE
+    #define SELFTEST_UART_MODE              SELFTEST_UART_MODE_LOOPBACK
+#endif
+#ifndef SELFTEST_UART_MAX_LINE_ERRORS
+    #define SELFTEST_UART_MAX_LINE_ERRORS   2u
+#endif
+#ifndef SELFTEST_UART_MIN_FRAMES
+    #define SELFTEST_UART_MIN_FRAMES        100u
+#endif
+#ifndef SELFTEST_UART_MIN_CRC_PERMILLE
+    #define SELFTEST_UART_MIN_CRC_PERMILLE  990u
+#endif
+#ifndef SELFTEST_UART_TRAFFIC_TIMEOUT
+    #define SELFTEST_UART_TRAFFIC_TIMEOUT   1000u   // Ticks
+#endif
+#ifndef SELFTEST_UART_LOOPBACK_FALLBACK
+    #define SELFTEST_UART_LOOPBACK_FALLBACK true
+#endif
+
+//*** Free running counters of the UART driver *****
+typedef struct
+{
+    u32 ulRxFrames;                     // Received frames
+    u32 ulCrcErrors;                    // Received frames with wrong CRC
+    u32 ulFramingErrors;                // Characters with framing error
+    u32 ulParityErrors;                 // Characters with parity error
+    u32 ulOverrunErrors;                // Receiver overruns
+} tsSelfTest_UartCounters;
+
+//*** State of the passive UART test *****
+typedef struct
+{
+    u32 ulLineErrors;                   // Framing, parity and overrun errors since start
+    u32 ulCrcPermille;                  // Last judged CRC pass ratio
+    u32 ulLoopbacks;                    // Loopback tests in quiet windows
+    u32 ulLastTraffic;                  // Time tick of the last received frame
+} tsSelfTest_UartStatus;
+
+/************************ externally visible functions ***********************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+u8 OS_SelfTest_UART_Check(void);
+void OS_SelfTest_UART_GetStatus(tsSelfTest_UartStatus* psStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //USE_OS_SELF_TEST
+
+#endif // SELFTEST_UART_H
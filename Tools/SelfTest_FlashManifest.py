@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+#********************************************************************************
+# \author     Kraemer E.
+# \date       16.10.2026
+#
+# \file       SelfTest_FlashManifest.py
+# \brief      Post-link step for SELFTEST_FLASH_MODE_MANIFEST.
+#             Reads the binary application image and writes the flash manifest
+#             ( tsSelfTest_FlashManifest, little endian ) with one CRC-32 per tile.
+#             The manifest has to be placed at SELFTEST_FLASH_MANIFEST_ADR, e.g.
+#             objcopy --update-section .selftest_manifest=manifest.bin app.elf
+#             The tile size should match ST_FLASH_TILE_SIZE of SelfTest_Config.h,
+#             CRC_INIT_VALUE has to be 0xFFFFFFFF.
+#
+#             Usage: SelfTest_FlashManifest.py image.bin start_address tile_size manifest.bin
+#********************************************************************************
+import struct
+import sys
+import zlib
+
+MANIFEST_SIGNATURE = 0x464D5453     # "STMF"
+
+
+def build_manifest(image, start_address, tile_size):
+    tiles = [image[offset:offset + tile_size] for offset in range(0, len(image), tile_size)]
+    manifest = struct.pack("<5I", MANIFEST_SIGNATURE, start_address, len(image), tile_size, len(tiles))
+    manifest += b"".join(struct.pack("<I", zlib.crc32(tile)) for tile in tiles)
+    return manifest + struct.pack("<I", zlib.crc32(manifest))
+
+
+def main(argv):
+    if len(argv) != 5:
+        sys.exit("Usage: SelfTest_FlashManifest.py image.bin start_address tile_size manifest.bin")
+
+    with open(argv[1], "rb") as image_file:
+        image = image_file.read()
+
+    manifest = build_manifest(image, int(argv[2], 0), int(argv[3], 0))
+
+    with open(argv[4], "wb") as manifest_file:
+        manifest_file.write(manifest)
+
+
+if __name__ == "__main__":
+    main(sys.argv)